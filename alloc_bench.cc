@@ -0,0 +1,412 @@
+#include <omp.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include "alloc_bench.h"
+#include "commons.h"
+
+// The array sizes (in floats) every kernel gets instantiated for, the same as in privatization_bench.
+// The allocate clause needs private arrays with a size known at compile time.
+#define ALLOC_ARRAY_SIZES(X) \
+    X(1) X(4) X(16) X(64) X(256) X(1024) X(4096) X(16384) X(65536) X(262144)
+
+#define ARRAY_SIZE_VALUE(SIZE) SIZE,
+const std::vector<unsigned long long> ALLOC_ARRAY_SIZE_VALUES{ALLOC_ARRAY_SIZES(ARRAY_SIZE_VALUE)};
+#undef ARRAY_SIZE_VALUE
+
+/// @brief An allocator and the name used in the test names
+struct NamedAllocator {
+    std::string name;
+    omp_allocator_handle_t handle;
+    /// the allocate clauses and tasks are only measured for some allocators, otherwise there are too many tests
+    bool in_clauses;
+};
+
+const std::vector<NamedAllocator> PREDEFINED_ALLOCATORS{
+        {"DEFAULT", omp_default_mem_alloc, true},
+        {"LARGE_CAP", omp_large_cap_mem_alloc, false},
+        {"CONST", omp_const_mem_alloc, false},
+        {"HIGH_BW", omp_high_bw_mem_alloc, false},
+        {"LOW_LAT", omp_low_lat_mem_alloc, false},
+        {"CGROUP", omp_cgroup_mem_alloc, false},
+        {"PTEAM", omp_pteam_mem_alloc, false},
+        {"THREAD", omp_thread_mem_alloc, true}};
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+std::string bench_name = "ALLOC";
+
+// the array size of the current benchmark, the kernels are dispatched by it
+unsigned long long array_size = 1;
+
+// the allocator of the current benchmark
+omp_allocator_handle_t allocator = omp_default_mem_alloc;
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (ARRAY_SIZES.empty()) {
+        ARRAY_SIZES = ALLOC_ARRAY_SIZE_VALUES;
+    }
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+/// @brief Creates the allocators with traits for the given allocation size,
+/// allocators not supported by the runtime are skipped
+std::vector<NamedAllocator> InitCustomAllocators(unsigned long long bytes) {
+    unsigned long long max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+
+    omp_alloctrait_t aligned_64[] = {{omp_atk_alignment, 64}};
+    omp_alloctrait_t aligned_4096[] = {{omp_atk_alignment, 4096}};
+    omp_alloctrait_t pinned[] = {{omp_atk_pinned, omp_atv_true}};
+    // one allocation per thread fits into the pool
+    omp_alloctrait_t pool[] = {{omp_atk_pool_size, bytes * max_threads}, {omp_atk_fallback, omp_atv_default_mem_fb}};
+    // no allocation fits into the pool, every allocation uses the fallback
+    omp_alloctrait_t fallback[] = {{omp_atk_pool_size, 1}, {omp_atk_fallback, omp_atv_default_mem_fb}};
+
+    std::vector<NamedAllocator> candidates{
+            {"ALIGNED_64", omp_init_allocator(omp_default_mem_space, 1, aligned_64), false},
+            {"ALIGNED_4096", omp_init_allocator(omp_default_mem_space, 1, aligned_4096), false},
+            {"PINNED", omp_init_allocator(omp_default_mem_space, 1, pinned), false},
+            {"POOL", omp_init_allocator(omp_default_mem_space, 2, pool), true},
+            {"FALLBACK", omp_init_allocator(omp_default_mem_space, 2, fallback), false}};
+
+    std::vector<NamedAllocator> allocators;
+    for (const NamedAllocator &candidate : candidates) {
+        if (candidate.handle == omp_null_allocator) {
+            std::cout << "Skipping allocator " << candidate.name << ", not supported by the runtime" << std::endl;
+        } else {
+            allocators.push_back(candidate);
+        }
+    }
+    return allocators;
+}
+
+void RunBenchmarks() {
+    for (unsigned long long size : ARRAY_SIZES) {
+        if (std::find(ALLOC_ARRAY_SIZE_VALUES.begin(), ALLOC_ARRAY_SIZE_VALUES.end(), size) == ALLOC_ARRAY_SIZE_VALUES.end()) {
+            std::cout << "Skipping array size " << size << ", not in ALLOC_ARRAY_SIZES" << std::endl;
+            continue;
+        }
+        array_size = size;
+        unsigned long long bytes = size * sizeof(float);
+
+        // exported in bytes, so that the fitted model directly gives the cost per allocated byte
+        std::vector<Parameter> parameters{{"Bytes", bytes}};
+
+        Benchmark(bench_name, "MALLOC", TestAllocMalloc, Reference, parameters);
+        Benchmark(bench_name, "NEW", TestAllocNew, Reference, parameters);
+        Benchmark(bench_name, "PRIVATE", TestAllocPrivate, Reference, parameters);
+        Benchmark(bench_name, "FIRSTPRIVATE", TestAllocFirstprivate, Reference, parameters);
+        Benchmark(bench_name, "TASK_MALLOC", TestAllocTaskMalloc, Reference, parameters);
+        Benchmark(bench_name, "TASK_PRIVATE", TestAllocTaskPrivate, Reference, parameters);
+
+        std::vector<NamedAllocator> custom_allocators = InitCustomAllocators(bytes);
+        std::vector<NamedAllocator> allocators = PREDEFINED_ALLOCATORS;
+        allocators.insert(allocators.end(), custom_allocators.begin(), custom_allocators.end());
+
+        for (const NamedAllocator &named_allocator : allocators) {
+            // a predefined allocator may have no memory space on this system
+            void *probe = omp_alloc(bytes, named_allocator.handle);
+            if (probe == nullptr) {
+                std::cout << "Skipping allocator " << named_allocator.name << ", omp_alloc returned NULL" << std::endl;
+                continue;
+            }
+            omp_free(probe, named_allocator.handle);
+
+            allocator = named_allocator.handle;
+            Benchmark(bench_name, "OMP_ALLOC_" + named_allocator.name, TestAllocOmpAlloc, Reference, parameters);
+            if (named_allocator.in_clauses) {
+                Benchmark(bench_name, "PRIVATE_ALLOCATE_" + named_allocator.name, TestAllocPrivateAllocate, Reference, parameters);
+                Benchmark(bench_name, "FIRSTPRIVATE_ALLOCATE_" + named_allocator.name, TestAllocFirstprivateAllocate, Reference, parameters);
+                Benchmark(bench_name, "TASK_OMP_ALLOC_" + named_allocator.name, TestAllocTaskOmpAlloc, Reference, parameters);
+                Benchmark(bench_name, "TASK_PRIVATE_ALLOCATE_" + named_allocator.name, TestAllocTaskPrivateAllocate, Reference, parameters);
+            }
+        }
+
+        for (const NamedAllocator &custom_allocator : custom_allocators) {
+            omp_destroy_allocator(custom_allocator.handle);
+        }
+    }
+}
+
+// allocate variables right away to reduce measured work
+unsigned int threads;
+unsigned long long int iterations;
+unsigned long workload;
+
+// The loops are the same as in doall_bench, but every iteration (or thread for the clauses) works on its own array with SIZE floats
+
+template<unsigned long SIZE>
+struct MallocKernel {
+    static void Run(const DataPoint& data) {
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload)
+            for (int i = 0; i < iterations; i++) {
+                float *array = (float *) malloc(SIZE * sizeof(float));
+                ARRAY_DELAY(workload, i, array);
+                free(array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct NewKernel {
+    static void Run(const DataPoint& data) {
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload)
+            for (int i = 0; i < iterations; i++) {
+                float *array = new float[SIZE];
+                ARRAY_DELAY(workload, i, array);
+                delete[] array;
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct OmpAllocKernel {
+    static void Run(const DataPoint& data) {
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, allocator)
+            for (int i = 0; i < iterations; i++) {
+                float *array = (float *) omp_alloc(SIZE * sizeof(float), allocator);
+                ARRAY_DELAY(workload, i, array);
+                omp_free(array, allocator);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct PrivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) private(array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct PrivateAllocateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, allocator) private(array) allocate(allocator : array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct FirstprivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) firstprivate(array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct FirstprivateAllocateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, allocator) firstprivate(array) allocate(allocator : array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct TaskMallocKernel {
+    static void Run(const DataPoint& data) {
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload)
+            {
+                #pragma omp master
+                {
+                    for (int i = 0; i < iterations; i++) {
+                        #pragma omp task default(none) firstprivate(i) shared(workload)
+                        {
+                            float *array = (float *) malloc(SIZE * sizeof(float));
+                            ARRAY_DELAY(workload, i, array);
+                            free(array);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct TaskOmpAllocKernel {
+    static void Run(const DataPoint& data) {
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, allocator)
+            {
+                #pragma omp master
+                {
+                    for (int i = 0; i < iterations; i++) {
+                        #pragma omp task default(none) firstprivate(i) shared(workload, allocator)
+                        {
+                            float *array = (float *) omp_alloc(SIZE * sizeof(float), allocator);
+                            ARRAY_DELAY(workload, i, array);
+                            omp_free(array, allocator);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct TaskPrivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload)
+            {
+                #pragma omp master
+                {
+                    for (int i = 0; i < iterations; i++) {
+                        #pragma omp task default(none) firstprivate(i) shared(workload) private(array)
+                        {
+                            ARRAY_DELAY(workload, i, array);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct TaskPrivateAllocateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, allocator)
+            {
+                #pragma omp master
+                {
+                    for (int i = 0; i < iterations; i++) {
+                        #pragma omp task default(none) firstprivate(i) shared(workload, allocator) private(array) allocate(allocator : array)
+                        {
+                            ARRAY_DELAY(workload, i, array);
+                        }
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct ReferenceKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<template<unsigned long> class KERNEL>
+void Dispatch(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+
+    switch (array_size) {
+        #define DISPATCH_ARRAY_SIZE(SIZE) case SIZE: KERNEL<SIZE>::Run(data); break;
+        ALLOC_ARRAY_SIZES(DISPATCH_ARRAY_SIZE)
+        #undef DISPATCH_ARRAY_SIZE
+        default:
+            printf("No instantiation for array size %llu\n", array_size);
+            exit(-1);
+    }
+}
+
+void TestAllocMalloc(const DataPoint& data) {
+    Dispatch<MallocKernel>(data);
+}
+
+void TestAllocNew(const DataPoint& data) {
+    Dispatch<NewKernel>(data);
+}
+
+void TestAllocOmpAlloc(const DataPoint& data) {
+    Dispatch<OmpAllocKernel>(data);
+}
+
+void TestAllocPrivate(const DataPoint& data) {
+    Dispatch<PrivateKernel>(data);
+}
+
+void TestAllocPrivateAllocate(const DataPoint& data) {
+    Dispatch<PrivateAllocateKernel>(data);
+}
+
+void TestAllocFirstprivate(const DataPoint& data) {
+    Dispatch<FirstprivateKernel>(data);
+}
+
+void TestAllocFirstprivateAllocate(const DataPoint& data) {
+    Dispatch<FirstprivateAllocateKernel>(data);
+}
+
+void TestAllocTaskMalloc(const DataPoint& data) {
+    Dispatch<TaskMallocKernel>(data);
+}
+
+void TestAllocTaskOmpAlloc(const DataPoint& data) {
+    Dispatch<TaskOmpAllocKernel>(data);
+}
+
+void TestAllocTaskPrivate(const DataPoint& data) {
+    Dispatch<TaskPrivateKernel>(data);
+}
+
+void TestAllocTaskPrivateAllocate(const DataPoint& data) {
+    Dispatch<TaskPrivateAllocateKernel>(data);
+}
+
+void Reference(const DataPoint& data) {
+    Dispatch<ReferenceKernel>(data);
+}
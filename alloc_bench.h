@@ -0,0 +1,54 @@
+#ifndef PPT_P4_ALLOC_H
+#define PPT_P4_ALLOC_H
+
+#include "commons.h"
+
+/// @brief Worksharing loop, every iteration allocates and frees an array with malloc
+/// @param data the configuration for the microbenchmark
+void TestAllocMalloc(const DataPoint& data);
+
+/// @brief Worksharing loop, every iteration allocates and frees an array with new and delete
+/// @param data the configuration for the microbenchmark
+void TestAllocNew(const DataPoint& data);
+
+/// @brief Worksharing loop, every iteration allocates and frees an array with omp_alloc and the current allocator
+/// @param data the configuration for the microbenchmark
+void TestAllocOmpAlloc(const DataPoint& data);
+
+/// @brief Worksharing loop with a private array, without allocate clause
+/// @param data the configuration for the microbenchmark
+void TestAllocPrivate(const DataPoint& data);
+
+/// @brief Worksharing loop with a private array, allocated with the current allocator by the allocate clause
+/// @param data the configuration for the microbenchmark
+void TestAllocPrivateAllocate(const DataPoint& data);
+
+/// @brief Worksharing loop with a firstprivate array, without allocate clause
+/// @param data the configuration for the microbenchmark
+void TestAllocFirstprivate(const DataPoint& data);
+
+/// @brief Worksharing loop with a firstprivate array, allocated with the current allocator by the allocate clause
+/// @param data the configuration for the microbenchmark
+void TestAllocFirstprivateAllocate(const DataPoint& data);
+
+/// @brief Tasks created by the master thread, every task allocates and frees an array with malloc
+/// @param data the configuration for the microbenchmark
+void TestAllocTaskMalloc(const DataPoint& data);
+
+/// @brief Tasks created by the master thread, every task allocates and frees an array with omp_alloc and the current allocator
+/// @param data the configuration for the microbenchmark
+void TestAllocTaskOmpAlloc(const DataPoint& data);
+
+/// @brief Tasks created by the master thread with a private array, without allocate clause
+/// @param data the configuration for the microbenchmark
+void TestAllocTaskPrivate(const DataPoint& data);
+
+/// @brief Tasks created by the master thread with a private array, allocated with the current allocator by the allocate clause
+/// @param data the configuration for the microbenchmark
+void TestAllocTaskPrivateAllocate(const DataPoint& data);
+
+/// @brief Reference implementation, the loop works on a static array without any allocation
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+#endif //PPT_P4_ALLOC_H
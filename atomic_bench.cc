@@ -0,0 +1,239 @@
+#include <omp.h>
+#include <iostream>
+#include "commons.h"
+#include "atomic_bench.h"
+
+// Runs all Benchmarks
+void RunBenchmarks();
+
+std::string bench_name = "ATOMIC";
+
+// The memory order and type of the atomics are exported as Extra-P parameters, with these codes.
+// NONE is the directive without memory order clause, the flushes have the type of the flushed variable
+enum AtomicOrder { SEQ_CST, ACQ_REL, ACQUIRE, RELEASE, RELAXED, NONE };
+enum AtomicType { INT32, INT64, FLOAT, DOUBLE };
+
+const std::vector<std::string> ORDER_NAMES{"seq_cst", "acq_rel", "acquire", "release", "relaxed", "none"};
+const std::vector<std::string> TYPE_NAMES{"int32", "int64", "float", "double"};
+
+/// @brief The Extra-P parameters of an atomic with the given memory order and type
+std::vector<Parameter> AtomicParameters(AtomicOrder order, AtomicType type) {
+    return {{"Order", (unsigned long long) order}, {"Type", (unsigned long long) type}};
+}
+
+/// @brief Prints which memory order and type belongs to which parameter value
+void PrintParameterLegend();
+
+/// @brief Runs all valid combinations of atomic construct and memory order for the type T
+template<typename T>
+void RunAtomicMatrix(AtomicType type);
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    PrintParameterLegend();
+
+    RunAtomicMatrix<int>(INT32);
+    RunAtomicMatrix<long long>(INT64);
+    RunAtomicMatrix<float>(FLOAT);
+    RunAtomicMatrix<double>(DOUBLE);
+
+    Benchmark(bench_name, "FLUSH", TestFlushSeqCst, Reference, AtomicParameters(SEQ_CST, INT32));
+    Benchmark(bench_name, "FLUSH", TestFlushAcqRel, Reference, AtomicParameters(ACQ_REL, INT32));
+    Benchmark(bench_name, "FLUSH", TestFlushRelease, Reference, AtomicParameters(RELEASE, INT32));
+    Benchmark(bench_name, "FLUSH", TestFlushAcquire, Reference, AtomicParameters(ACQUIRE, INT32));
+    Benchmark(bench_name, "FLUSH", TestFlushNone, Reference, AtomicParameters(NONE, INT32));
+    Benchmark(bench_name, "FLUSH_LIST", TestFlushList, Reference, AtomicParameters(NONE, INT32));
+}
+
+void PrintParameterLegend() {
+    std::cout << "Parameter Order: ";
+    for (size_t i = 0; i < ORDER_NAMES.size(); i++) {
+        std::cout << i << " = " << ORDER_NAMES[i] << (i + 1 < ORDER_NAMES.size() ? ", " : "\n");
+    }
+    std::cout << "Parameter Type: ";
+    for (size_t i = 0; i < TYPE_NAMES.size(); i++) {
+        std::cout << i << " = " << TYPE_NAMES[i] << (i + 1 < TYPE_NAMES.size() ? ", " : "\n");
+    }
+}
+
+// DoAll loop with one atomic construct on the shared variable x after the computation.
+// CLAUSES are the atomic clause and the memory order, STATEMENT is the atomic statement,
+// it can use the private variables value and candidate (decreasing with i, for the compare)
+#define DEFINE_ATOMIC_TEST(NAME, CLAUSES, STATEMENT) \
+template<typename T> \
+void NAME(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        T x = (T) iterations; \
+        PRAGMA(omp parallel for shared(iterations, workload, x) default(none) num_threads(threads)) \
+        for (int i = 0; i < iterations; i++) { \
+            T value; \
+            T candidate = (T) (iterations - i); \
+            DELAY(workload, i); \
+            PRAGMA(omp atomic CLAUSES) \
+            STATEMENT; \
+            (void) value; \
+            (void) candidate; \
+        } \
+    } \
+}
+
+// the same statement without atomic, serial
+#define DEFINE_ATOMIC_REFERENCE(NAME, STATEMENT) \
+template<typename T> \
+void NAME(const DataPoint& data) { \
+    unsigned int threads = data.threads; /* not used, only here for equal amount of work in Test and Reference */ \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        T x = (T) iterations; \
+        for (int i = 0; i < iterations; i++) { \
+            T value; \
+            T candidate = (T) (iterations - i); \
+            DELAY(workload, i); \
+            STATEMENT; \
+            (void) value; \
+            (void) candidate; \
+        } \
+        (void) x; \
+    } \
+}
+
+#define READ_STATEMENT value = x
+#define WRITE_STATEMENT x = candidate
+#define UPDATE_STATEMENT x += 1
+#define CAPTURE_STATEMENT value = x++
+#define COMPARE_STATEMENT if (candidate < x) { x = candidate; }
+
+// read must not be release, write must not be acquire (OpenMP 5.1)
+DEFINE_ATOMIC_TEST(TestReadSeqCst, read seq_cst, READ_STATEMENT)
+DEFINE_ATOMIC_TEST(TestReadAcqRel, read acq_rel, READ_STATEMENT)
+DEFINE_ATOMIC_TEST(TestReadAcquire, read acquire, READ_STATEMENT)
+DEFINE_ATOMIC_TEST(TestReadRelaxed, read relaxed, READ_STATEMENT)
+DEFINE_ATOMIC_TEST(TestReadNone, read, READ_STATEMENT)
+
+DEFINE_ATOMIC_TEST(TestWriteSeqCst, write seq_cst, WRITE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestWriteAcqRel, write acq_rel, WRITE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestWriteRelease, write release, WRITE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestWriteRelaxed, write relaxed, WRITE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestWriteNone, write, WRITE_STATEMENT)
+
+DEFINE_ATOMIC_TEST(TestUpdateSeqCst, update seq_cst, UPDATE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestUpdateAcqRel, update acq_rel, UPDATE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestUpdateAcquire, update acquire, UPDATE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestUpdateRelease, update release, UPDATE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestUpdateRelaxed, update relaxed, UPDATE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestUpdateNone, update, UPDATE_STATEMENT)
+
+DEFINE_ATOMIC_TEST(TestCaptureSeqCst, capture seq_cst, CAPTURE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCaptureAcqRel, capture acq_rel, CAPTURE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCaptureAcquire, capture acquire, CAPTURE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCaptureRelease, capture release, CAPTURE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCaptureRelaxed, capture relaxed, CAPTURE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCaptureNone, capture, CAPTURE_STATEMENT)
+
+DEFINE_ATOMIC_TEST(TestCompareSeqCst, compare seq_cst, COMPARE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCompareAcqRel, compare acq_rel, COMPARE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCompareAcquire, compare acquire, COMPARE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCompareRelease, compare release, COMPARE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCompareRelaxed, compare relaxed, COMPARE_STATEMENT)
+DEFINE_ATOMIC_TEST(TestCompareNone, compare, COMPARE_STATEMENT)
+
+DEFINE_ATOMIC_REFERENCE(ReferenceRead, READ_STATEMENT)
+DEFINE_ATOMIC_REFERENCE(ReferenceWrite, WRITE_STATEMENT)
+DEFINE_ATOMIC_REFERENCE(ReferenceUpdate, UPDATE_STATEMENT)
+DEFINE_ATOMIC_REFERENCE(ReferenceCapture, CAPTURE_STATEMENT)
+DEFINE_ATOMIC_REFERENCE(ReferenceCompare, COMPARE_STATEMENT)
+
+template<typename T>
+void RunAtomicMatrix(AtomicType type) {
+    Benchmark(bench_name, "READ", TestReadSeqCst<T>, ReferenceRead<T>, AtomicParameters(SEQ_CST, type));
+    Benchmark(bench_name, "READ", TestReadAcqRel<T>, ReferenceRead<T>, AtomicParameters(ACQ_REL, type));
+    Benchmark(bench_name, "READ", TestReadAcquire<T>, ReferenceRead<T>, AtomicParameters(ACQUIRE, type));
+    Benchmark(bench_name, "READ", TestReadRelaxed<T>, ReferenceRead<T>, AtomicParameters(RELAXED, type));
+    Benchmark(bench_name, "READ", TestReadNone<T>, ReferenceRead<T>, AtomicParameters(NONE, type));
+
+    Benchmark(bench_name, "WRITE", TestWriteSeqCst<T>, ReferenceWrite<T>, AtomicParameters(SEQ_CST, type));
+    Benchmark(bench_name, "WRITE", TestWriteAcqRel<T>, ReferenceWrite<T>, AtomicParameters(ACQ_REL, type));
+    Benchmark(bench_name, "WRITE", TestWriteRelease<T>, ReferenceWrite<T>, AtomicParameters(RELEASE, type));
+    Benchmark(bench_name, "WRITE", TestWriteRelaxed<T>, ReferenceWrite<T>, AtomicParameters(RELAXED, type));
+    Benchmark(bench_name, "WRITE", TestWriteNone<T>, ReferenceWrite<T>, AtomicParameters(NONE, type));
+
+    Benchmark(bench_name, "UPDATE", TestUpdateSeqCst<T>, ReferenceUpdate<T>, AtomicParameters(SEQ_CST, type));
+    Benchmark(bench_name, "UPDATE", TestUpdateAcqRel<T>, ReferenceUpdate<T>, AtomicParameters(ACQ_REL, type));
+    Benchmark(bench_name, "UPDATE", TestUpdateAcquire<T>, ReferenceUpdate<T>, AtomicParameters(ACQUIRE, type));
+    Benchmark(bench_name, "UPDATE", TestUpdateRelease<T>, ReferenceUpdate<T>, AtomicParameters(RELEASE, type));
+    Benchmark(bench_name, "UPDATE", TestUpdateRelaxed<T>, ReferenceUpdate<T>, AtomicParameters(RELAXED, type));
+    Benchmark(bench_name, "UPDATE", TestUpdateNone<T>, ReferenceUpdate<T>, AtomicParameters(NONE, type));
+
+    Benchmark(bench_name, "CAPTURE", TestCaptureSeqCst<T>, ReferenceCapture<T>, AtomicParameters(SEQ_CST, type));
+    Benchmark(bench_name, "CAPTURE", TestCaptureAcqRel<T>, ReferenceCapture<T>, AtomicParameters(ACQ_REL, type));
+    Benchmark(bench_name, "CAPTURE", TestCaptureAcquire<T>, ReferenceCapture<T>, AtomicParameters(ACQUIRE, type));
+    Benchmark(bench_name, "CAPTURE", TestCaptureRelease<T>, ReferenceCapture<T>, AtomicParameters(RELEASE, type));
+    Benchmark(bench_name, "CAPTURE", TestCaptureRelaxed<T>, ReferenceCapture<T>, AtomicParameters(RELAXED, type));
+    Benchmark(bench_name, "CAPTURE", TestCaptureNone<T>, ReferenceCapture<T>, AtomicParameters(NONE, type));
+
+    Benchmark(bench_name, "COMPARE", TestCompareSeqCst<T>, ReferenceCompare<T>, AtomicParameters(SEQ_CST, type));
+    Benchmark(bench_name, "COMPARE", TestCompareAcqRel<T>, ReferenceCompare<T>, AtomicParameters(ACQ_REL, type));
+    Benchmark(bench_name, "COMPARE", TestCompareAcquire<T>, ReferenceCompare<T>, AtomicParameters(ACQUIRE, type));
+    Benchmark(bench_name, "COMPARE", TestCompareRelease<T>, ReferenceCompare<T>, AtomicParameters(RELEASE, type));
+    Benchmark(bench_name, "COMPARE", TestCompareRelaxed<T>, ReferenceCompare<T>, AtomicParameters(RELAXED, type));
+    Benchmark(bench_name, "COMPARE", TestCompareNone<T>, ReferenceCompare<T>, AtomicParameters(NONE, type));
+}
+
+// DoAll loop with a flush after the computation, CLAUSE is the memory order or the list
+#define DEFINE_FLUSH_TEST(NAME, CLAUSE) \
+void NAME(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        int x = 0; \
+        PRAGMA(omp parallel for shared(iterations, workload, x) default(none) num_threads(threads)) \
+        for (int i = 0; i < iterations; i++) { \
+            DELAY(workload, i); \
+            PRAGMA(omp flush CLAUSE) \
+        } \
+        (void) x; \
+    } \
+}
+
+DEFINE_FLUSH_TEST(TestFlushSeqCst, seq_cst)
+DEFINE_FLUSH_TEST(TestFlushAcqRel, acq_rel)
+DEFINE_FLUSH_TEST(TestFlushRelease, release)
+DEFINE_FLUSH_TEST(TestFlushAcquire, acquire)
+DEFINE_FLUSH_TEST(TestFlushNone, )
+DEFINE_FLUSH_TEST(TestFlushList, (x))
+
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        int x = 0;
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+        }
+        (void) x;
+    }
+}
@@ -0,0 +1,39 @@
+#ifndef PPT_P4_ATOMIC_H
+#define PPT_P4_ATOMIC_H
+
+#include "commons.h"
+
+// The atomic read, write, update, capture and compare tests are generated for every memory order
+// with DEFINE_ATOMIC_TEST in atomic_bench.cc, the memory order has to be a token of the directive.
+
+/// @brief DoAll loop with a flush without list and with the memory order seq_cst, acq_rel, release, acquire or none
+/// after the computation
+/// @param data the configuration for the microbenchmark
+void TestFlushSeqCst(const DataPoint& data);
+void TestFlushAcqRel(const DataPoint& data);
+void TestFlushRelease(const DataPoint& data);
+void TestFlushAcquire(const DataPoint& data);
+void TestFlushNone(const DataPoint& data);
+
+/// @brief DoAll loop with a flush of a list with one shared variable after the computation
+/// @param data the configuration for the microbenchmark
+void TestFlushList(const DataPoint& data);
+
+/// @brief Reference implementations of the atomic tests, the same statement without atomic
+/// @param data the configuration for the reference
+template<typename T>
+void ReferenceRead(const DataPoint& data);
+template<typename T>
+void ReferenceWrite(const DataPoint& data);
+template<typename T>
+void ReferenceUpdate(const DataPoint& data);
+template<typename T>
+void ReferenceCapture(const DataPoint& data);
+template<typename T>
+void ReferenceCompare(const DataPoint& data);
+
+/// @brief Reference implementation for the flush tests
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+#endif //PPT_P4_ATOMIC_H
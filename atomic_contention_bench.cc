@@ -0,0 +1,201 @@
+#include <omp.h>
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include "commons.h"
+#include "atomic_contention_bench.h"
+
+// Runs all Benchmarks
+void RunBenchmarks();
+
+/// @brief Prints the place of every thread for the three bindings, with the maximum number of threads
+void PrintThreadPlacement();
+
+std::string bench_name = "ATOMIC_CONTENTION";
+
+// The configuration of the sweep is exported as Extra-P parameters, pattern and binding with these codes.
+// OWN: every thread only updates its own counters
+// NEIGHBOR: every second update goes to the counters of the next thread, so every counter is shared by two threads
+// RANDOM: every update goes to a pseudo-random counter
+enum AccessPattern { OWN, NEIGHBOR, RANDOM };
+// MASTER: all threads on the place of the master thread, e.g. the same core with OMP_PLACES=cores
+// CLOSE: the threads on neighboring places, e.g. the same socket
+// SPREAD: the threads spread over all places, e.g. all sockets
+enum Binding { MASTER, CLOSE, SPREAD };
+
+const std::vector<std::string> PATTERN_NAMES{"own", "neighbor", "random"};
+const std::vector<std::string> BINDING_NAMES{"master", "close", "spread"};
+
+// the targets go up to TARGETS_PER_THREAD counters per thread of the maximum number of threads
+#define TARGETS_PER_THREAD 4
+// the largest distance of two counters, two cache lines because of the adjacent line prefetcher
+#define MAX_PADDING 128
+
+// The configuration of the current test
+unsigned long long num_targets = 1;
+unsigned long long padding = sizeof(long long);
+AccessPattern access_pattern = OWN;
+
+// the counters, num_targets counters with a distance of padding bytes
+char *targets;
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    unsigned int max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    targets = (char *) aligned_alloc(MAX_PADDING, max_threads * TARGETS_PER_THREAD * MAX_PADDING);
+
+    RunBenchmarks();
+
+    free(targets);
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    unsigned int max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    void (*const tests[])(const DataPoint&) = {TestContentionMaster, TestContentionClose, TestContentionSpread};
+
+    std::cout << "Parameter Pattern: 0 = " << PATTERN_NAMES[OWN] << ", 1 = " << PATTERN_NAMES[NEIGHBOR]
+              << ", 2 = " << PATTERN_NAMES[RANDOM] << std::endl;
+    std::cout << "Parameter Binding: 0 = " << BINDING_NAMES[MASTER] << ", 1 = " << BINDING_NAMES[CLOSE]
+              << ", 2 = " << BINDING_NAMES[SPREAD] << std::endl;
+    PrintThreadPlacement();
+
+    for (Binding binding : {MASTER, CLOSE, SPREAD}) {
+        for (AccessPattern pattern : {OWN, NEIGHBOR, RANDOM}) {
+            access_pattern = pattern;
+            // packed, one cache line and two cache lines per counter
+            for (unsigned long long bytes : {(unsigned long long) sizeof(long long), 64ull, (unsigned long long) MAX_PADDING}) {
+                padding = bytes;
+                for (num_targets = 1; num_targets <= max_threads * TARGETS_PER_THREAD; num_targets *= 2) {
+                    std::vector<Parameter> parameters = {{"Targets", num_targets}, {"Padding", padding},
+                                                         {"Pattern", (unsigned long long) pattern},
+                                                         {"Binding", (unsigned long long) binding}};
+                    Benchmark(bench_name, "UPDATE", *tests[binding], Reference, parameters);
+                }
+            }
+        }
+    }
+}
+
+void PrintThreadPlacement() {
+    unsigned int max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    std::vector<int> places(max_threads);
+
+    if (QUIET) {
+        return;
+    }
+    if (omp_get_num_places() == 0) {
+        std::cout << "The threads are not bound, set OMP_PLACES (e.g. cores or threads) to compare the bindings" << std::endl;
+        return;
+    }
+
+    std::cout << "Places of the threads with " << omp_get_num_places() << " places" << std::endl;
+
+    #pragma omp parallel num_threads(max_threads) proc_bind(master) default(none) shared(places)
+    places[omp_get_thread_num()] = omp_get_place_num();
+    std::cout << BINDING_NAMES[MASTER] << ":";
+    for (int place : places) {
+        std::cout << " " << place;
+    }
+    std::cout << std::endl;
+
+    #pragma omp parallel num_threads(max_threads) proc_bind(close) default(none) shared(places)
+    places[omp_get_thread_num()] = omp_get_place_num();
+    std::cout << BINDING_NAMES[CLOSE] << ":";
+    for (int place : places) {
+        std::cout << " " << place;
+    }
+    std::cout << std::endl;
+
+    #pragma omp parallel num_threads(max_threads) proc_bind(spread) default(none) shared(places)
+    places[omp_get_thread_num()] = omp_get_place_num();
+    std::cout << BINDING_NAMES[SPREAD] << ":";
+    for (int place : places) {
+        std::cout << " " << place;
+    }
+    std::cout << std::endl;
+}
+
+/// @brief The index of the counter updated by thread in iteration i
+/// @param state the state of the pseudo-random numbers of the thread
+ALWAYS_INLINE unsigned long long TargetIndex(AccessPattern pattern, unsigned long long thread, unsigned long long threads,
+                                             unsigned long long i, unsigned long long count, unsigned long long &state) {
+    if (pattern == RANDOM) {
+        // 64 bit linear congruential generator (Knuth's MMIX), the high bits are the most random
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return (state >> 33) % count;
+    }
+    if (pattern == NEIGHBOR && i % 2 == 1) {
+        thread = (thread + 1) % threads;
+    }
+    if (count < threads) {
+        return thread % count;
+    }
+    // the counters thread, thread + threads, thread + 2 * threads, ... belong to the thread
+    return thread + threads * (i % (count / threads));
+}
+
+// The parallel region of the contention tests, the binding has to be a token of the directive
+#define DEFINE_CONTENTION_TEST(NAME, BINDING) \
+void NAME(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    unsigned long long count = num_targets; \
+    unsigned long long stride = padding; \
+    AccessPattern pattern = access_pattern; \
+    char *counters = targets; \
+\
+    for (unsigned long long target = 0; target < count; target++) { \
+        *(long long *) (counters + target * stride) = 0; \
+    } \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel num_threads(threads) proc_bind(BINDING) default(none) \
+               shared(threads, iterations, workload, count, stride, pattern, counters)) \
+        { \
+            unsigned long long thread = omp_get_thread_num(); \
+            unsigned long long state = thread + 1; \
+            PRAGMA(omp for) \
+            for (int i = 0; i < iterations; i++) { \
+                DELAY(workload, i); \
+                long long *counter = (long long *) (counters + TargetIndex(pattern, thread, threads, i, count, state) * stride); \
+                PRAGMA(omp atomic) \
+                *counter += 1; \
+            } \
+        } \
+    } \
+}
+
+// proc_bind(master) is called primary since OpenMP 5.1
+DEFINE_CONTENTION_TEST(TestContentionMaster, master)
+DEFINE_CONTENTION_TEST(TestContentionClose, close)
+DEFINE_CONTENTION_TEST(TestContentionSpread, spread)
+
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned long long count = num_targets;
+    unsigned long long stride = padding;
+    AccessPattern pattern = access_pattern;
+    char *counters = targets;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        unsigned long long state = 1;
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+            long long *counter = (long long *) (counters + TargetIndex(pattern, 0, 1, i, count, state) * stride);
+            *counter += 1;
+        }
+    }
+}
@@ -0,0 +1,18 @@
+#ifndef PPT_P4_ATOMIC_CONTENTION_H
+#define PPT_P4_ATOMIC_CONTENTION_H
+
+#include "commons.h"
+
+/// @brief DoAll loop with an atomic update of one of several counters after the computation.
+/// The number of counters, their distance in bytes and the access pattern are set before the test,
+/// the threads are bound to the places with proc_bind master, close or spread
+/// @param data the configuration for the microbenchmark
+void TestContentionMaster(const DataPoint& data);
+void TestContentionClose(const DataPoint& data);
+void TestContentionSpread(const DataPoint& data);
+
+/// @brief Reference implementation, the same updates without atomic in one thread
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+#endif //PPT_P4_ATOMIC_CONTENTION_H
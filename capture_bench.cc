@@ -0,0 +1,137 @@
+#include <omp.h>
+#include "capture_bench.h"
+#include "commons.h"
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+std::string bench_name = "CAPTURE";
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    // the number of captured variables is exported as the additional Extra-P parameter Captures
+    Benchmark(bench_name, "EMPTY", TestEmpty, Reference, {{"Captures", 0}});
+
+    Benchmark(bench_name, "SHARED", TestShared1, Reference1, {{"Captures", 1}});
+    Benchmark(bench_name, "SHARED", TestShared4, Reference4, {{"Captures", 4}});
+    Benchmark(bench_name, "SHARED", TestShared16, Reference16, {{"Captures", 16}});
+    Benchmark(bench_name, "SHARED", TestShared64, Reference64, {{"Captures", 64}});
+    Benchmark(bench_name, "SHARED", TestShared256, Reference256, {{"Captures", 256}});
+
+    Benchmark(bench_name, "FIRSTPRIVATE", TestFirstprivate1, Reference1, {{"Captures", 1}});
+    Benchmark(bench_name, "FIRSTPRIVATE", TestFirstprivate4, Reference4, {{"Captures", 4}});
+    Benchmark(bench_name, "FIRSTPRIVATE", TestFirstprivate16, Reference16, {{"Captures", 16}});
+    Benchmark(bench_name, "FIRSTPRIVATE", TestFirstprivate64, Reference64, {{"Captures", 64}});
+    Benchmark(bench_name, "FIRSTPRIVATE", TestFirstprivate256, Reference256, {{"Captures", 256}});
+}
+
+// The captured scalars are generated with CAPTURES_<COUNT>, which applies MACRO to COUNT distinct names,
+// the names are the base 4 digits of their index, e.g. capture_0013 is the scalar 7 of CAPTURES_256
+#define CAPTURES_1(MACRO, NAME) MACRO(NAME##0)
+#define CAPTURES_4(MACRO, NAME) MACRO(NAME##0) MACRO(NAME##1) MACRO(NAME##2) MACRO(NAME##3)
+#define CAPTURES_16(MACRO, NAME) CAPTURES_4(MACRO, NAME##0) CAPTURES_4(MACRO, NAME##1) \
+        CAPTURES_4(MACRO, NAME##2) CAPTURES_4(MACRO, NAME##3)
+#define CAPTURES_64(MACRO, NAME) CAPTURES_16(MACRO, NAME##0) CAPTURES_16(MACRO, NAME##1) \
+        CAPTURES_16(MACRO, NAME##2) CAPTURES_16(MACRO, NAME##3)
+#define CAPTURES_256(MACRO, NAME) CAPTURES_64(MACRO, NAME##0) CAPTURES_64(MACRO, NAME##1) \
+        CAPTURES_64(MACRO, NAME##2) CAPTURES_64(MACRO, NAME##3)
+
+// the address is taken, otherwise GCC passes shared scalars which are never written by value, like firstprivate
+#define DECLARE_CAPTURE(NAME) float NAME = 1; float *NAME##_address = &NAME; (void) NAME##_address;
+#define READ_CAPTURE(NAME) sum += NAME;
+// every variable gets its own clause, so that no comma separated list has to be generated
+#define SHARED_CLAUSE(NAME) shared(NAME)
+#define FIRSTPRIVATE_CLAUSE(NAME) firstprivate(NAME)
+
+void TestEmpty(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload)
+        {
+            unsigned int team_size = omp_get_num_threads();
+            for (unsigned long long i = omp_get_thread_num(); i < iterations; i += team_size) {
+                DELAY(workload, i);
+            }
+        }
+    }
+}
+
+// The scalars are declared in the test, so that they are captured by the parallel region and not accessed as globals
+#define DEFINE_CAPTURE_TEST(NAME, COUNT, CLAUSE) \
+void NAME##COUNT(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    CAPTURES_##COUNT(DECLARE_CAPTURE, capture_) \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel num_threads(threads) default(none) shared(iterations, workload) \
+               CAPTURES_##COUNT(CLAUSE, capture_)) \
+        { \
+            float sum = 0; \
+            CAPTURES_##COUNT(READ_CAPTURE, capture_) \
+            unsigned int team_size = omp_get_num_threads(); \
+            for (unsigned long long i = omp_get_thread_num(); i < iterations; i += team_size) { \
+                DELAY(workload, i); \
+                DCE_PREVENTION(sum, i) \
+            } \
+        } \
+    } \
+}
+
+#define DEFINE_CAPTURE_REFERENCE(COUNT) \
+void Reference##COUNT(const DataPoint& data) { \
+    unsigned int threads = data.threads; /* not used, only here for equal amount of work in Test and Reference */ \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    CAPTURES_##COUNT(DECLARE_CAPTURE, capture_) \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        float sum = 0; \
+        CAPTURES_##COUNT(READ_CAPTURE, capture_) \
+        for (int i = 0; i < iterations; i++) { \
+            DELAY(workload, i); \
+            DCE_PREVENTION(sum, i) \
+        } \
+    } \
+}
+
+#define DEFINE_CAPTURE_TESTS(COUNT) \
+DEFINE_CAPTURE_TEST(TestShared, COUNT, SHARED_CLAUSE) \
+DEFINE_CAPTURE_TEST(TestFirstprivate, COUNT, FIRSTPRIVATE_CLAUSE) \
+DEFINE_CAPTURE_REFERENCE(COUNT)
+
+DEFINE_CAPTURE_TESTS(1)
+DEFINE_CAPTURE_TESTS(4)
+DEFINE_CAPTURE_TESTS(16)
+DEFINE_CAPTURE_TESTS(64)
+DEFINE_CAPTURE_TESTS(256)
+
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+        }
+    }
+}
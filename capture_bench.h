@@ -0,0 +1,36 @@
+#ifndef PPT_P4_CAPTURE_H
+#define PPT_P4_CAPTURE_H
+
+#include "commons.h"
+
+/// @brief Parallel region created for every directive without captured variables, the iterations are distributed by the thread number
+/// @param data the configuration for the microbenchmark
+void TestEmpty(const DataPoint& data);
+
+/// @brief The same parallel region as TestEmpty, every thread reads 1, 4, 16, 64 or 256 shared scalars,
+/// the compiler passes all of them to the outlined function
+/// @param data the configuration for the microbenchmark
+void TestShared1(const DataPoint& data);
+void TestShared4(const DataPoint& data);
+void TestShared16(const DataPoint& data);
+void TestShared64(const DataPoint& data);
+void TestShared256(const DataPoint& data);
+
+/// @brief The same parallel region as TestEmpty, every thread reads 1, 4, 16, 64 or 256 firstprivate scalars
+/// @param data the configuration for the microbenchmark
+void TestFirstprivate1(const DataPoint& data);
+void TestFirstprivate4(const DataPoint& data);
+void TestFirstprivate16(const DataPoint& data);
+void TestFirstprivate64(const DataPoint& data);
+void TestFirstprivate256(const DataPoint& data);
+
+/// @brief Reference implementations, read the scalars once per directive in one thread
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+void Reference1(const DataPoint& data);
+void Reference4(const DataPoint& data);
+void Reference16(const DataPoint& data);
+void Reference64(const DataPoint& data);
+void Reference256(const DataPoint& data);
+
+#endif //PPT_P4_CAPTURE_H
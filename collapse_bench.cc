@@ -0,0 +1,265 @@
+#include <omp.h>
+#include <cmath>
+#include "collapse_bench.h"
+#include "commons.h"
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+std::string bench_name = "COLLAPSE";
+
+// The shapes of the 2D loop nests, all with about the number of iterations as total iterations
+// TALL: iterations / SHORT_EXTENT outer iterations, SHORT_EXTENT inner iterations
+// WIDE: SHORT_EXTENT outer iterations, iterations / SHORT_EXTENT inner iterations, too few for the outer loop alone
+// SQUARE: sqrt(iterations) outer and inner iterations
+enum Shape { TALL, WIDE, SQUARE };
+
+#define SHORT_EXTENT 4
+
+Shape shape = SQUARE;
+
+/// @brief The extents of the 2D loop nest of the current shape
+void Extents2D(unsigned long long iterations, int &outer, int &inner) {
+    switch (shape) {
+        case TALL:
+            outer = (int) (iterations / SHORT_EXTENT);
+            inner = SHORT_EXTENT;
+            break;
+        case WIDE:
+            outer = SHORT_EXTENT;
+            inner = (int) (iterations / SHORT_EXTENT);
+            break;
+        case SQUARE:
+            outer = (int) sqrt((double) iterations);
+            inner = outer;
+            break;
+    }
+}
+
+/// @brief The extent of the triangular loop nest, extent * (extent + 1) / 2 is about the number of iterations
+int ExtentTriangular(unsigned long long iterations) {
+    return (int) ((sqrt(8.0 * iterations + 1) - 1) / 2);
+}
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    const std::vector<std::pair<std::string, Shape>> shapes = {{"TALL", TALL}, {"WIDE", WIDE}, {"SQUARE", SQUARE}};
+    for (const auto &current_shape : shapes) {
+        shape = current_shape.second;
+        Benchmark(bench_name, current_shape.first + "_COLLAPSE", TestCollapse2D, Reference2D);
+        Benchmark(bench_name, current_shape.first + "_FLATTENED", TestFlattened2D, Reference2D);
+        Benchmark(bench_name, current_shape.first + "_OUTER", TestOuter2D, Reference2D);
+    }
+
+    Benchmark(bench_name, "CUBE_COLLAPSE", TestCollapse3D, Reference3D);
+    Benchmark(bench_name, "CUBE_FLATTENED", TestFlattened3D, Reference3D);
+    Benchmark(bench_name, "CUBE_OUTER", TestOuter3D, Reference3D);
+
+    Benchmark(bench_name, "TRIANGULAR_COLLAPSE", TestCollapseTriangular, ReferenceTriangular);
+    Benchmark(bench_name, "TRIANGULAR_FLATTENED", TestFlattenedTriangular, ReferenceTriangular);
+    Benchmark(bench_name, "TRIANGULAR_OUTER", TestOuterTriangular, ReferenceTriangular);
+}
+
+void TestCollapse2D(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int outer, inner;
+    Extents2D(data.iterations, outer, inner);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for collapse(2) num_threads(threads) default(none) shared(outer, inner, workload)
+        for (int i = 0; i < outer; i++) {
+            for (int j = 0; j < inner; j++) {
+                DELAY(workload, i * inner + j);
+            }
+        }
+    }
+}
+
+void TestFlattened2D(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int outer, inner;
+    Extents2D(data.iterations, outer, inner);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(outer, inner, workload)
+        for (int k = 0; k < outer * inner; k++) {
+            int i = k / inner;
+            int j = k % inner;
+            DELAY(workload, i * inner + j);
+        }
+    }
+}
+
+void TestOuter2D(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int outer, inner;
+    Extents2D(data.iterations, outer, inner);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(outer, inner, workload)
+        for (int i = 0; i < outer; i++) {
+            for (int j = 0; j < inner; j++) {
+                DELAY(workload, i * inner + j);
+            }
+        }
+    }
+}
+
+void TestCollapse3D(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int extent = (int) cbrt((double) data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for collapse(3) num_threads(threads) default(none) shared(extent, workload)
+        for (int i = 0; i < extent; i++) {
+            for (int j = 0; j < extent; j++) {
+                for (int l = 0; l < extent; l++) {
+                    DELAY(workload, (i * extent + j) * extent + l);
+                }
+            }
+        }
+    }
+}
+
+void TestFlattened3D(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int extent = (int) cbrt((double) data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(extent, workload)
+        for (int k = 0; k < extent * extent * extent; k++) {
+            int i = k / (extent * extent);
+            int j = (k / extent) % extent;
+            int l = k % extent;
+            DELAY(workload, (i * extent + j) * extent + l);
+        }
+    }
+}
+
+void TestOuter3D(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int extent = (int) cbrt((double) data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(extent, workload)
+        for (int i = 0; i < extent; i++) {
+            for (int j = 0; j < extent; j++) {
+                for (int l = 0; l < extent; l++) {
+                    DELAY(workload, (i * extent + j) * extent + l);
+                }
+            }
+        }
+    }
+}
+
+void TestCollapseTriangular(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int extent = ExtentTriangular(data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for collapse(2) num_threads(threads) default(none) shared(extent, workload)
+        for (int i = 0; i < extent; i++) {
+            for (int j = 0; j <= i; j++) {
+                DELAY(workload, i * (i + 1) / 2 + j);
+            }
+        }
+    }
+}
+
+void TestFlattenedTriangular(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int extent = ExtentTriangular(data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(extent, workload)
+        for (int k = 0; k < extent * (extent + 1) / 2; k++) {
+            // row i starts at i * (i + 1) / 2
+            int i = (int) ((sqrt(8.0 * k + 1) - 1) / 2);
+            int j = k - i * (i + 1) / 2;
+            DELAY(workload, i * (i + 1) / 2 + j);
+        }
+    }
+}
+
+void TestOuterTriangular(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long workload = data.workload;
+    int extent = ExtentTriangular(data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        // the static schedule is imbalanced, the last rows are the longest
+        #pragma omp parallel for num_threads(threads) default(none) shared(extent, workload)
+        for (int i = 0; i < extent; i++) {
+            for (int j = 0; j <= i; j++) {
+                DELAY(workload, i * (i + 1) / 2 + j);
+            }
+        }
+    }
+}
+
+void Reference2D(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long workload = data.workload;
+    int outer, inner;
+    Extents2D(data.iterations, outer, inner);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < outer; i++) {
+            for (int j = 0; j < inner; j++) {
+                DELAY(workload, i * inner + j);
+            }
+        }
+    }
+}
+
+void Reference3D(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long workload = data.workload;
+    int extent = (int) cbrt((double) data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < extent; i++) {
+            for (int j = 0; j < extent; j++) {
+                for (int l = 0; l < extent; l++) {
+                    DELAY(workload, (i * extent + j) * extent + l);
+                }
+            }
+        }
+    }
+}
+
+void ReferenceTriangular(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long workload = data.workload;
+    int extent = ExtentTriangular(data.iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < extent; i++) {
+            for (int j = 0; j <= i; j++) {
+                DELAY(workload, i * (i + 1) / 2 + j);
+            }
+        }
+    }
+}
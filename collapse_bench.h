@@ -0,0 +1,48 @@
+#ifndef PPT_P4_COLLAPSE_H
+#define PPT_P4_COLLAPSE_H
+
+#include "commons.h"
+
+/// @brief DoAll loop nest of two loops with collapse(2), the shape of the nest is set before the test
+/// @param data the configuration for the microbenchmark
+void TestCollapse2D(const DataPoint& data);
+
+/// @brief The same loop nest as TestCollapse2D, manually flattened into one loop, the indices are recovered with / and %
+/// @param data the configuration for the microbenchmark
+void TestFlattened2D(const DataPoint& data);
+
+/// @brief The same loop nest as TestCollapse2D, only the outer loop is parallelized
+/// @param data the configuration for the microbenchmark
+void TestOuter2D(const DataPoint& data);
+
+/// @brief DoAll loop nest of three loops with the same extent with collapse(3)
+/// @param data the configuration for the microbenchmark
+void TestCollapse3D(const DataPoint& data);
+
+/// @brief The same loop nest as TestCollapse3D, manually flattened into one loop
+/// @param data the configuration for the microbenchmark
+void TestFlattened3D(const DataPoint& data);
+
+/// @brief The same loop nest as TestCollapse3D, only the outer loop is parallelized
+/// @param data the configuration for the microbenchmark
+void TestOuter3D(const DataPoint& data);
+
+/// @brief Triangular (non-rectangular, OpenMP 5.0) loop nest with collapse(2), the inner loop runs up to the outer index
+/// @param data the configuration for the microbenchmark
+void TestCollapseTriangular(const DataPoint& data);
+
+/// @brief The same loop nest as TestCollapseTriangular, manually flattened, the indices are recovered with a square root
+/// @param data the configuration for the microbenchmark
+void TestFlattenedTriangular(const DataPoint& data);
+
+/// @brief The same loop nest as TestCollapseTriangular, only the outer loop is parallelized
+/// @param data the configuration for the microbenchmark
+void TestOuterTriangular(const DataPoint& data);
+
+/// @brief Reference implementations, the serial loop nests
+/// @param data the configuration for the reference
+void Reference2D(const DataPoint& data);
+void Reference3D(const DataPoint& data);
+void ReferenceTriangular(const DataPoint& data);
+
+#endif //PPT_P4_COLLAPSE_H
@@ -10,6 +10,8 @@ using json = nlohmann::json;
 std::string METRIC_REFERENCE_TIME = "Reference time in us";
 std::string METRIC_TEST_TIME = "Test time in us";
 std::string METRIC_OVERHEAD = "Overhead time in us";
+std::string METRIC_OVERHEAD_PER_ITERATION = "Overhead time per iteration in us";
+std::string METRIC_THROUGHPUT = "Throughput in iterations per us";
 
 std::vector<unsigned int> TEST_REPETITIONS{};
 std::vector<unsigned long long> NUMBER_OF_ITERATIONS{};
@@ -28,6 +30,8 @@ bool SAVE_FOR_EXTRAP{false};
 std::string OUTFILE_NAME = "";
 bool EPCC{false};
 bool EMPTY_PARALLEL_REGION{false};
+bool PER_ITERATION{false};
+bool THROUGHPUT{false};
 
 json extrap_data;
 
@@ -62,11 +66,14 @@ void ParseArgs(int argc, char **argv) {
     app.add_option("-I,--Iterations", NUMBER_OF_ITERATIONS, "Amount of iterations inside the constructs (vector)(default: 100)");
     app.add_option("-W,--Workload", AMOUNT_OF_WORKLOAD, "Workload in iterations inside the constructs (vector)(default: 2)");
     app.add_option("-D,--Directive", DIRECTIVE_REPETITIONS, "Amount of times the directives should be repeated(default: 1)");
+    app.add_option("-N,--ArraySizes", ARRAY_SIZES, "Number of floats in the privatized or allocated arrays (vector)(default: all instantiated sizes)");
     app.add_option("-O,--Output", OUTFILE_NAME, "Save the data in json format (readable by ExtraP) at the specified location");
     app.add_flag("-P,--EmptyParallelRegion", EMPTY_PARALLEL_REGION, "Creates an empty parallel region with n threads before every benchmark to avoid measuring initial thread creation overhead");
     app.add_flag("-E,--EPCC", EPCC, "[EXPERIMENTAL] Enables overhead calculation of EPCC");
     app.add_flag("-Q,--Quiet", QUIET, "Disables the print to stdout");
     app.add_flag("-C,--Clamp", CLAMP_LOW, "Due to variance in measurements negative overheads are possible. This flag clamps overheads to values >=1.0");
+    app.add_flag("-U,--PerIteration", PER_ITERATION, "Additionally reports the overhead divided by the number of iterations (for task benchmarks: per task)");
+    app.add_flag("-H,--Throughput", THROUGHPUT, "Additionally reports the iterations per us of the test, of all threads together");
 
     try {
         (app).parse((argc), (argv));
@@ -101,6 +108,8 @@ void ParseArgs(int argc, char **argv) {
         DIRECTIVE_REPETITIONS = 1;
     }
 
+    sort(ARRAY_SIZES.begin(), ARRAY_SIZES.end(), std::greater<>());
+
     SAVE_FOR_EXTRAP = OUTFILE_NAME != "";
 }
 
@@ -145,6 +154,12 @@ void Benchmark(void (&test)(const DataPoint&), DataPoint &datapoint) {
 
 void Benchmark(const std::string &bench_name, const std::string &test_name,
                void (&test)(const DataPoint&), void (&ref)(const DataPoint&)) {
+    Benchmark(bench_name, test_name, test, ref, {});
+}
+
+void Benchmark(const std::string &bench_name, const std::string &test_name,
+               void (&test)(const DataPoint&), void (&ref)(const DataPoint&),
+               const std::vector<Parameter> &parameters, double serial_fraction) {
 
     // We set this one, so that OpenMP doesn't choose any number of threads <= num_threads
     // OpenMP will always choose the selected number of threads this way
@@ -164,6 +179,7 @@ void Benchmark(const std::string &bench_name, const std::string &test_name,
                 single_reference_data.workload = workload;
                 single_reference_data.directive = DIRECTIVE_REPETITIONS;
                 single_reference_data.threads = 1;
+                single_reference_data.parameters = parameters;
                 Benchmark(ref, single_reference_data);
 
                 for (unsigned int threads: NUMBER_OF_THREADS) {
@@ -188,12 +204,14 @@ void Benchmark(const std::string &bench_name, const std::string &test_name,
                     single_test_data.iterations = iterations;
                     single_test_data.workload = workload;
                     single_test_data.directive = DIRECTIVE_REPETITIONS;
+                    single_test_data.parameters = parameters;
 
                     single_overhead_data.repetitions = repetitions;
                     single_overhead_data.threads = threads;
                     single_overhead_data.iterations = iterations;
                     single_overhead_data.workload = workload;
                     single_overhead_data.directive = DIRECTIVE_REPETITIONS;
+                    single_overhead_data.parameters = parameters;
 
                     // Benchmark section
                     Benchmark(test, single_test_data);
@@ -207,11 +225,12 @@ void Benchmark(const std::string &bench_name, const std::string &test_name,
 
                     test_data.push_back(single_test_data);
 
-                    // Calculate Overhead := (T_parallel - (T_seq / N_threads))
+                    // Calculate Overhead := (T_parallel - (T_seq / N_threads)),
+                    // with a serial fraction s (Amdahl's law): T_parallel - T_seq * (s + (1 - s) / N_threads)
                     for (int result = 0; result < single_test_data.time.size()/*<==>repetitions*/; result++) {
                         long double reference_time = single_reference_data.time.at(result);
                         long double test_time = single_test_data.time.at(result);
-                        long double overhead = test_time - (reference_time / threads);
+                        long double overhead = test_time - reference_time * (serial_fraction + (1 - serial_fraction) / threads);
 
                         if(CLAMP_LOW && overhead <= 1.0){
                             overhead = 1.0;
@@ -235,15 +254,56 @@ void Benchmark(const std::string &bench_name, const std::string &test_name,
     if (!QUIET) {
         PrintStats(test_name, overhead_data);
     }
+
+    if (PER_ITERATION) {
+        std::vector<DataPoint> per_iteration_data = overhead_data;
+        for (auto &data : per_iteration_data) {
+            for (auto &time : data.time) {
+                time = time / data.iterations;
+            }
+        }
+
+        if (SAVE_FOR_EXTRAP) {
+            SaveStatsForExtrap(bench_name, test_name, per_iteration_data, METRIC_OVERHEAD_PER_ITERATION);
+        }
+
+        if (!QUIET) {
+            PrintStats(test_name + " per iteration", per_iteration_data);
+        }
+    }
+
+    if (THROUGHPUT) {
+        std::vector<DataPoint> throughput_data = test_data;
+        for (auto &data : throughput_data) {
+            for (auto &time : data.time) {
+                time = data.iterations / time;
+            }
+        }
+
+        if (SAVE_FOR_EXTRAP) {
+            SaveStatsForExtrap(bench_name, test_name, throughput_data, METRIC_THROUGHPUT);
+        }
+
+        if (!QUIET) {
+            PrintStats(test_name + " throughput", throughput_data, "Iterations per us");
+        }
+    }
 }
 
 
 void PrintStats(const std::string &test_name,
-                const std::vector<DataPoint> &datapoints)
+                const std::vector<DataPoint> &datapoints,
+                const std::string &metric)
 {
     std::cout << "Name of test: " << test_name << std::endl;
 
-    std::cout << "Repetitions | Threads | Iterations | Workload in iterations | Overhead in us " << std::endl;
+    std::cout << "Repetitions | Threads | Iterations | Workload in iterations | ";
+    if (!datapoints.empty()) {
+        for (const auto &parameter : datapoints.at(0).parameters) {
+            std::cout << parameter.name << " | ";
+        }
+    }
+    std::cout << metric << " " << std::endl;
 
     for (auto data : datapoints) {
         sort(data.time.begin(), data.time.end());
@@ -251,8 +311,11 @@ void PrintStats(const std::string &test_name,
         std::cout << std::setw(11) << data.repetitions
                   << " | " << std::setw(7) << data.threads
                   << " | " << std::setw(10) << data.iterations
-                  << " | " << std::setw(22) << data.workload
-                  << " | " << std::setw(14) << std::fixed << std::setprecision(4) << data.time.at(data.time.size()/2) << std::endl;
+                  << " | " << std::setw(22) << data.workload;
+        for (const auto &parameter : data.parameters) {
+            std::cout << " | " << std::setw(parameter.name.size()) << parameter.value;
+        }
+        std::cout << " | " << std::setw(14) << std::fixed << std::setprecision(4) << data.time.at(data.time.size()/2) << std::endl;
     }
 
     std::cout << "----------------------------------------------------------------------------" << std::endl;
@@ -284,6 +347,9 @@ void SaveStatsForExtrap(const std::string &bench_name, // TODO remove bench_name
     for (const auto &data : datapoints)
     {
         points["point"] = {data.threads, data.workload, data.iterations};
+        for (const auto &parameter : data.parameters) {
+            points["point"] += parameter.value;
+        }
         for (auto points_at_x : data.time){
             points_array += points_at_x;
         }
@@ -297,6 +363,11 @@ void SaveStatsForExtrap(const std::string &bench_name, // TODO remove bench_name
 
     extrap_data["measurements"][test_name][metric_type] = values_and_points;
     extrap_data["parameters"] = {"Threads", "Workload", "Iterations"};
+    if (!datapoints.empty()) {
+        for (const auto &parameter : datapoints.at(0).parameters) {
+            extrap_data["parameters"] += parameter.name;
+        }
+    }
 
     file_to_write_to << std::setw(2) << extrap_data << std::endl;
 }
@@ -3,9 +3,16 @@
 
 #include <sys/time.h>
 #include <string>
+#include <utility>
 #include <vector>
 
 
+/// @brief An additional Extra-P parameter of a microbenchmark, next to threads, workload and iterations
+struct Parameter {
+    std::string name;
+    unsigned long long value;
+};
+
 /// @brief Used as a data storage, and microbenchmark configuration
 struct DataPoint {
 public:
@@ -16,6 +23,9 @@ public:
     unsigned int repetitions;
     unsigned int directive;
 
+    /// Additional parameters, exported to Extra-P after threads, workload and iterations
+    std::vector<Parameter> parameters;
+
     /// Only used in TaskTree
     unsigned int tasks;
     unsigned int child_nodes;
@@ -38,7 +48,7 @@ extern std::vector<unsigned int> NUMBER_OF_THREADS;
 /// @brief The number of calculations in each loop iteration and task
 extern std::vector<unsigned long> AMOUNT_OF_WORKLOAD;
 
-/// @brief The sizes of the arrays copied to the target (GPU)
+/// @brief The sizes of the arrays copied to the target (GPU), or privatized by the privatization benchmark
 extern std::vector<unsigned long long> ARRAY_SIZES;
 
 /// @brief The number of teams in use on the GPU
@@ -71,6 +81,12 @@ extern bool EPCC;
 /// @brief Creates an empty parallel region with n threads before every benchmark to avoid measuring initial thread creation overhead
 extern bool EMPTY_PARALLEL_REGION;
 
+/// @brief Additionally reports the overhead divided by the number of iterations, e.g. the overhead of a single task
+extern bool PER_ITERATION;
+
+/// @brief Additionally reports the iterations per us of the test, e.g. the operations per us of all threads together
+extern bool THROUGHPUT;
+
 /// @brief Calculates the difference between before and after time measurements
 /// @param before the earlier time
 /// @param after the later time
@@ -97,6 +113,19 @@ void ParseArgsTaskTree(int argc , char **argv);
 void Benchmark(const std::string &bench_name, const std::string &test_name, void (&test)(const DataPoint&),
                void (&ref)(const DataPoint&));
 
+/// @brief The same as Benchmark, but every measurement is exported with additional parameters.
+/// The microbenchmark has to set the corresponding configuration itself, e.g. in a global variable.
+/// All tests written into one file have to use the same parameter names, otherwise Extra-P can't read it
+/// @param bench_name the bench_name of the microbenchmark
+/// @param test_name the bench_name of the individual test
+/// @param test the reference to the function to get benchmarked
+/// @param ref the reference to the reference function, typically a serial implementation of the same code
+/// @param parameters the names and values of the additional parameters
+/// @param serial_fraction the fraction of the reference that can't run in parallel, e.g. in a critical section.
+/// The overhead is then the time above Amdahl's law instead of the time above the reference divided by the threads
+void Benchmark(const std::string &bench_name, const std::string &test_name, void (&test)(const DataPoint&),
+               void (&ref)(const DataPoint&), const std::vector<Parameter> &parameters, double serial_fraction = 0.0);
+
 /// @brief These benchmark methods are getting called by the microbenchmarks itself
 /// @param bench_name the name of the microbenchmark
 /// @param test_name the name of the individual test
@@ -119,7 +148,9 @@ void BenchmarkTaskTree(const std::string &bench_name, const std::string &test_na
 /// @brief Prints the median of each benchmark
 /// @param test_name the name of each individual test
 /// @param datapoints the measurements that are getting collected by the Benchmark function
-void PrintStats(const std::string &test_name, const std::vector<DataPoint> &datapoints);
+/// @param metric the name and unit of the printed values
+void PrintStats(const std::string &test_name, const std::vector<DataPoint> &datapoints,
+                const std::string &metric = "Overhead in us");
 
 /// @brief Prints the median of each benchmark
 /// @param test_name the name of each individual test
@@ -179,8 +210,7 @@ void ArrayDelayFunction(unsigned int iteration, unsigned long workload, float *a
 // benefit of the preprocessor makro: no function call overhead (the function might or might not be inlined by compilers, the macro is always the same)
 // possible improvement in the future: create a more specific workload
 //  - allow to specify how many reads/writes/calculations we want there to be
-//  - do not use a programmatic loop, unroll it at compile time e.g. using advanced preprocessor mechanics (maybe use boost library?)
-//  this is however difficult when considering caching and DCE
+// a compile time unrolled version of DELAY is available as UNROLLED_DELAY, it needs the workload as a constant expression
 #ifdef PREVENT_DCE
     // VAR1 should be created by the workload generation --> prevent eliminiation of workload
     // VAR2 should be the iteration index of the surrounding loop --> prevent moving the workload out of the loop
@@ -217,6 +247,35 @@ DCE_PREVENTION(ARRAY[0], ITERATION)
 // if PREVENT_DCE is defined, the following code is also added: if (VAR1 < 0) { printf("%f \n", DELAY_A + (float) (i));}
 
 
+// use PRAGMA to generate OpenMP directives inside of macros, e.g. PRAGMA(omp threadprivate(VAR##SIZE))
+// the argument is expanded first, so that pasted tokens and list macros end up in the directive
+#define PRAGMA(DIRECTIVE) PRAGMA_STRING(DIRECTIVE)
+#define PRAGMA_STRING(DIRECTIVE) _Pragma(#DIRECTIVE)
+
+
+#if defined(__GNUC__) || defined(__clang__)
+    // the unrolled body has to be inlined even at -O0, otherwise we measure a function call instead of a loop
+    #define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+    #define ALWAYS_INLINE inline
+#endif
+
+/// @brief The loop body of DELAY, unrolled at compile time. Every DELAY_I is a constant in the instruction stream
+/// @param delay_a the accumulator, the same as DELAY_A in DELAY
+template<std::size_t... DELAY_I>
+ALWAYS_INLINE void UnrolledDelayBody(float &delay_a, std::index_sequence<DELAY_I...>) {
+    // C++14 has no fold expressions, the pack is expanded inside an array initializer instead
+    int expansion[] = {0, (delay_a += (float) DELAY_I, 0)...};
+    (void) expansion;
+}
+
+// the same as DELAY, but WORKLOAD has to be a constant expression and there is no programmatic loop
+#define UNROLLED_DELAY(WORKLOAD, ITERATION) \
+float DELAY_A; /*a needs to be local*/\
+UnrolledDelayBody(DELAY_A, std::make_index_sequence<(WORKLOAD)>{}); \
+DCE_PREVENTION(DELAY_A, ITERATION)
+
+
 /// @brief Returns false, used for conditional in OpenMP constructs.
 /// @returns false
 int ReturnFalse();
@@ -0,0 +1,367 @@
+#include <algorithm>
+#include <iostream>
+#include "constexpr_bench.h"
+#include "commons.h"
+
+// The iterations and workloads every kernel gets instantiated for.
+// Only these values can be benchmarked, others given in the config are dropped.
+// Can be overwritten at compile time, e.g. -DCONSTEXPR_ITERATIONS="10,20"
+#ifndef CONSTEXPR_ITERATIONS
+#define CONSTEXPR_ITERATIONS 100, 1000, 2000, 3000, 4000, 5000
+#endif
+
+#ifndef CONSTEXPR_WORKLOADS
+#define CONSTEXPR_WORKLOADS 2, 10, 50, 100, 200, 500, 1000
+#endif
+
+template<unsigned long long... ITERATIONS>
+struct IterationList {};
+
+template<unsigned long... WORKLOADS>
+struct WorkloadList {};
+
+const std::vector<unsigned long long> CONSTEXPR_ITERATION_VALUES{CONSTEXPR_ITERATIONS};
+const std::vector<unsigned long> CONSTEXPR_WORKLOAD_VALUES{CONSTEXPR_WORKLOADS};
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+// Removes all configured iterations and workloads without a compile time instantiation
+void RestrictToInstantiations();
+
+std::string bench_name = "CONSTEXPR";
+
+int chunk_size = 1;
+
+// the results of the iterations and of the reduction, allocated for the largest instantiated number of iterations
+float *results;
+float reduction_result;
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    RestrictToInstantiations();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    results = new float[*std::max_element(CONSTEXPR_ITERATION_VALUES.begin(), CONSTEXPR_ITERATION_VALUES.end())];
+
+    RunBenchmarks();
+
+    delete[] results;
+
+    return 0;
+}
+
+void RestrictToInstantiations() {
+    if (EPCC) {
+        // EPCC scales the iterations with the number of threads, these are not known at compile time
+        std::cout << "EPCC-style overhead calculation is not supported by this benchmark" << std::endl;
+        exit(-1);
+    }
+
+    auto not_instantiated_iterations = [](unsigned long long iterations) {
+        return std::find(CONSTEXPR_ITERATION_VALUES.begin(), CONSTEXPR_ITERATION_VALUES.end(), iterations)
+               == CONSTEXPR_ITERATION_VALUES.end();
+    };
+    auto not_instantiated_workload = [](unsigned long workload) {
+        return std::find(CONSTEXPR_WORKLOAD_VALUES.begin(), CONSTEXPR_WORKLOAD_VALUES.end(), workload)
+               == CONSTEXPR_WORKLOAD_VALUES.end();
+    };
+
+    for (unsigned long long iterations : NUMBER_OF_ITERATIONS) {
+        if (not_instantiated_iterations(iterations)) {
+            std::cout << "Skipping " << iterations << " iterations, not in CONSTEXPR_ITERATIONS" << std::endl;
+        }
+    }
+    for (unsigned long workload : AMOUNT_OF_WORKLOAD) {
+        if (not_instantiated_workload(workload)) {
+            std::cout << "Skipping workload " << workload << ", not in CONSTEXPR_WORKLOADS" << std::endl;
+        }
+    }
+
+    NUMBER_OF_ITERATIONS.erase(std::remove_if(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end(),
+                                              not_instantiated_iterations), NUMBER_OF_ITERATIONS.end());
+    AMOUNT_OF_WORKLOAD.erase(std::remove_if(AMOUNT_OF_WORKLOAD.begin(), AMOUNT_OF_WORKLOAD.end(),
+                                            not_instantiated_workload), AMOUNT_OF_WORKLOAD.end());
+
+    if (NUMBER_OF_ITERATIONS.empty() || AMOUNT_OF_WORKLOAD.empty()) {
+        std::cout << "No configured data point has a compile time instantiation" << std::endl;
+        exit(-1);
+    }
+}
+
+void RunBenchmarks() {
+    unsigned long long minimum_iterations = *std::min_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end());
+
+    // every kernel is followed by its twin with the runtime values, compared to the reference with the runtime values
+    Benchmark(bench_name, "DOALL", TestDoAllConstexpr, ReferenceConstexpr);
+    Benchmark(bench_name, "DOALL_RUNTIME", TestDoAllRuntime, ReferenceRuntime);
+    Benchmark(bench_name, "REDUCTION_FOR", ReductionForConstexpr, ReferenceReductionConstexpr);
+    Benchmark(bench_name, "REDUCTION_FOR_RUNTIME", ReductionForRuntime, ReferenceReductionRuntime);
+
+    for (unsigned long long chunk = 1; chunk <= minimum_iterations; chunk = chunk * 2) {
+        chunk_size = chunk;
+        Benchmark(bench_name, "STATIC_NON_MON_" + std::to_string(chunk), TestSchedStaticNonmonConstexpr, ReferenceConstexpr);
+        Benchmark(bench_name, "STATIC_NON_MON_RUNTIME_" + std::to_string(chunk), TestSchedStaticNonmonRuntime, ReferenceRuntime);
+        Benchmark(bench_name, "DYNAMIC_NON_MON_" + std::to_string(chunk), TestSchedDynamicNonmonConstexpr, ReferenceConstexpr);
+        Benchmark(bench_name, "DYNAMIC_NON_MON_RUNTIME_" + std::to_string(chunk), TestSchedDynamicNonmonRuntime, ReferenceRuntime);
+        Benchmark(bench_name, "GUIDED_NON_MON_" + std::to_string(chunk), TestSchedGuidedNonmonConstexpr, ReferenceConstexpr);
+        Benchmark(bench_name, "GUIDED_NON_MON_RUNTIME_" + std::to_string(chunk), TestSchedGuidedNonmonRuntime, ReferenceRuntime);
+    }
+}
+
+// At -O2 the workload has to start at a value unknown at compile time and its result has to be stored,
+// otherwise it is folded or removed. The accumulator starts at the iteration, the results are stored in 'results'.
+#define SEEDED_UNROLLED_DELAY(WORKLOAD, ITERATION) \
+float DELAY_A = (float) (ITERATION); \
+UnrolledDelayBody(DELAY_A, std::make_index_sequence<(WORKLOAD)>{});
+
+#define SEEDED_DELAY(WORKLOAD, ITERATION) \
+float DELAY_A = (float) (ITERATION); \
+for (int DELAY_I = 0; DELAY_I < WORKLOAD; DELAY_I++) \
+{ \
+    DELAY_A += (float) DELAY_I; \
+}
+
+// The loops have the same shape as in doall_bench, reduction_bench and schedule_bench.
+// Every loop is written once and used twice: in a class template with ITERATIONS and WORKLOAD as template parameters
+// and the unrolled workload, so that it can be handed to the dispatch as a template template parameter,
+// and in a function with the runtime values and the workload loop, built with the same flags for the comparison.
+// CAPTURES are the variables of the default(none) clause, the template parameters don't need one.
+
+#define DOALL_LOOP(ITERATIONS, WORKLOAD, DELAY_MACRO, CAPTURES) \
+for (int rep = 0; rep < data.directive; rep++) { \
+    PRAGMA(omp parallel for num_threads(threads) default(none) shared(results) CAPTURES) \
+    for (int i = 0; i < ITERATIONS; i++) { \
+        DELAY_MACRO(WORKLOAD, i) \
+        results[i] = DELAY_A; \
+    } \
+}
+
+#define REDUCTION_FOR_LOOP(ITERATIONS, WORKLOAD, DELAY_MACRO, CAPTURES) \
+for (int rep = 0; rep < data.directive; rep++) { \
+    float var = 0; \
+    PRAGMA(omp parallel for reduction(+ : var) default(none) num_threads(threads) CAPTURES) \
+    for (int i = 0; i < ITERATIONS; i++) { \
+        DELAY_MACRO(WORKLOAD, i) \
+        var = var + DELAY_A; \
+    } \
+    reduction_result = var; \
+}
+
+#define SCHEDULE_LOOP(SCHEDULE, ITERATIONS, WORKLOAD, DELAY_MACRO, CAPTURES) \
+PRAGMA(omp parallel default(none) shared(directive, chunk_size, results) num_threads(threads) CAPTURES) \
+{ \
+    for (int rep = 0; rep < directive; rep++) { \
+        PRAGMA(omp for schedule(nonmonotonic : SCHEDULE, chunk_size)) \
+        for (int i = 0; i < ITERATIONS; i++) { \
+            DELAY_MACRO(WORKLOAD, i) \
+            results[i] = DELAY_A; \
+        } \
+    } \
+}
+
+#define REFERENCE_LOOP(ITERATIONS, WORKLOAD, DELAY_MACRO) \
+for (int rep = 0; rep < data.directive; rep++) { \
+    for (int i = 0; i < ITERATIONS; i++) { \
+        DELAY_MACRO(WORKLOAD, i) \
+        results[i] = DELAY_A; \
+    } \
+}
+
+#define REFERENCE_REDUCTION_LOOP(ITERATIONS, WORKLOAD, DELAY_MACRO) \
+for (int rep = 0; rep < data.directive; rep++) { \
+    float var = 0; \
+    for (int i = 0; i < ITERATIONS; i++) { \
+        DELAY_MACRO(WORKLOAD, i) \
+        var = var + DELAY_A; \
+    } \
+    reduction_result = var; \
+}
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct DoAllKernel {
+    static void Run(const DataPoint& data) {
+        unsigned int threads = data.threads;
+        DOALL_LOOP(ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY, )
+    }
+};
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct ReductionForKernel {
+    static void Run(const DataPoint& data) {
+        unsigned int threads = data.threads;
+        REDUCTION_FOR_LOOP(ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY, )
+    }
+};
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct SchedStaticNonmonKernel {
+    static void Run(const DataPoint& data) {
+        unsigned int threads = data.threads;
+        unsigned int directive = data.directive;
+        SCHEDULE_LOOP(static, ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY, )
+    }
+};
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct SchedDynamicNonmonKernel {
+    static void Run(const DataPoint& data) {
+        unsigned int threads = data.threads;
+        unsigned int directive = data.directive;
+        SCHEDULE_LOOP(dynamic, ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY, )
+    }
+};
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct SchedGuidedNonmonKernel {
+    static void Run(const DataPoint& data) {
+        unsigned int threads = data.threads;
+        unsigned int directive = data.directive;
+        SCHEDULE_LOOP(guided, ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY, )
+    }
+};
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct ReferenceKernel {
+    static void Run(const DataPoint& data) {
+        REFERENCE_LOOP(ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY)
+    }
+};
+
+template<unsigned long long ITERATIONS, unsigned long WORKLOAD>
+struct ReferenceReductionKernel {
+    static void Run(const DataPoint& data) {
+        REFERENCE_REDUCTION_LOOP(ITERATIONS, WORKLOAD, SEEDED_UNROLLED_DELAY)
+    }
+};
+
+void TestDoAllRuntime(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    DOALL_LOOP(iterations, workload, SEEDED_DELAY, shared(iterations, workload))
+}
+
+void ReductionForRuntime(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    REDUCTION_FOR_LOOP(iterations, workload, SEEDED_DELAY, shared(iterations, workload))
+}
+
+void TestSchedStaticNonmonRuntime(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned int directive = data.directive;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    SCHEDULE_LOOP(static, iterations, workload, SEEDED_DELAY, shared(iterations, workload))
+}
+
+void TestSchedDynamicNonmonRuntime(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned int directive = data.directive;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    SCHEDULE_LOOP(dynamic, iterations, workload, SEEDED_DELAY, shared(iterations, workload))
+}
+
+void TestSchedGuidedNonmonRuntime(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned int directive = data.directive;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    SCHEDULE_LOOP(guided, iterations, workload, SEEDED_DELAY, shared(iterations, workload))
+}
+
+void ReferenceRuntime(const DataPoint& data) {
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    REFERENCE_LOOP(iterations, workload, SEEDED_DELAY)
+}
+
+void ReferenceReductionRuntime(const DataPoint& data) {
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    REFERENCE_REDUCTION_LOOP(iterations, workload, SEEDED_DELAY)
+}
+
+#undef DOALL_LOOP
+#undef REDUCTION_FOR_LOOP
+#undef SCHEDULE_LOOP
+#undef REFERENCE_LOOP
+#undef REFERENCE_REDUCTION_LOOP
+
+// Dispatch from the runtime values in 'data' to the matching instantiation.
+// The lists are walked recursively, each step compares against one compile time value.
+
+template<template<unsigned long long, unsigned long> class KERNEL, unsigned long long ITERATIONS>
+bool DispatchWorkload(const DataPoint& data, WorkloadList<>) {
+    return false;
+}
+
+template<template<unsigned long long, unsigned long> class KERNEL, unsigned long long ITERATIONS,
+         unsigned long WORKLOAD, unsigned long... REMAINING>
+bool DispatchWorkload(const DataPoint& data, WorkloadList<WORKLOAD, REMAINING...>) {
+    if (data.workload == WORKLOAD) {
+        KERNEL<ITERATIONS, WORKLOAD>::Run(data);
+        return true;
+    }
+    return DispatchWorkload<KERNEL, ITERATIONS>(data, WorkloadList<REMAINING...>{});
+}
+
+template<template<unsigned long long, unsigned long> class KERNEL>
+bool DispatchIterations(const DataPoint& data, IterationList<>) {
+    return false;
+}
+
+template<template<unsigned long long, unsigned long> class KERNEL,
+         unsigned long long ITERATIONS, unsigned long long... REMAINING>
+bool DispatchIterations(const DataPoint& data, IterationList<ITERATIONS, REMAINING...>) {
+    if (data.iterations == ITERATIONS) {
+        return DispatchWorkload<KERNEL, ITERATIONS>(data, WorkloadList<CONSTEXPR_WORKLOADS>{});
+    }
+    return DispatchIterations<KERNEL>(data, IterationList<REMAINING...>{});
+}
+
+template<template<unsigned long long, unsigned long> class KERNEL>
+void Dispatch(const DataPoint& data) {
+    if (!DispatchIterations<KERNEL>(data, IterationList<CONSTEXPR_ITERATIONS>{})) {
+        printf("No instantiation for %llu iterations and workload %lu\n", data.iterations, data.workload);
+        exit(-1);
+    }
+}
+
+void TestDoAllConstexpr(const DataPoint& data) {
+    Dispatch<DoAllKernel>(data);
+}
+
+void ReductionForConstexpr(const DataPoint& data) {
+    Dispatch<ReductionForKernel>(data);
+}
+
+void TestSchedStaticNonmonConstexpr(const DataPoint& data) {
+    Dispatch<SchedStaticNonmonKernel>(data);
+}
+
+void TestSchedDynamicNonmonConstexpr(const DataPoint& data) {
+    Dispatch<SchedDynamicNonmonKernel>(data);
+}
+
+void TestSchedGuidedNonmonConstexpr(const DataPoint& data) {
+    Dispatch<SchedGuidedNonmonKernel>(data);
+}
+
+void ReferenceConstexpr(const DataPoint& data) {
+    Dispatch<ReferenceKernel>(data);
+}
+
+void ReferenceReductionConstexpr(const DataPoint& data) {
+    Dispatch<ReferenceReductionKernel>(data);
+}
@@ -0,0 +1,48 @@
+#ifndef PPT_P4_CONSTEXPR_H
+#define PPT_P4_CONSTEXPR_H
+
+#include "commons.h"
+
+/// @brief DoAll loop with iterations and workload known at compile time, same construct as TestDoAll
+/// @param data the configuration for the microbenchmark
+void TestDoAllConstexpr(const DataPoint& data);
+
+/// @brief Reduction clause with a DoAll loop with iterations and workload known at compile time, same construct as ReductionFor
+/// @param data the configuration for the microbenchmark
+void ReductionForConstexpr(const DataPoint& data);
+
+/// @brief Scheduling using Static : nonmonotonic with a specified chunk_size, iterations and workload known at compile time
+/// @param data the configuration for the microbenchmark
+void TestSchedStaticNonmonConstexpr(const DataPoint& data);
+
+/// @brief Scheduling using Dynamic : nonmonotonic with a specified chunk_size, iterations and workload known at compile time
+/// @param data the configuration for the microbenchmark
+void TestSchedDynamicNonmonConstexpr(const DataPoint& data);
+
+/// @brief Scheduling using Guided : nonmonotonic with a specified chunk_size, iterations and workload known at compile time
+/// @param data the configuration for the microbenchmark
+void TestSchedGuidedNonmonConstexpr(const DataPoint& data);
+
+/// @brief Reference serial implementation with iterations and workload known at compile time
+/// @param data the configuration for the reference
+void ReferenceConstexpr(const DataPoint& data);
+
+/// @brief Reference serial implementation of a variable aggregation with iterations and workload known at compile time
+/// @param data the configuration for the reference
+void ReferenceReductionConstexpr(const DataPoint& data);
+
+/// @brief The same loops as the constexpr kernels with iterations and workload as runtime values and a workload loop,
+/// built with the same flags, so that the difference is only the knowledge of the loop shape
+/// @param data the configuration for the microbenchmark
+void TestDoAllRuntime(const DataPoint& data);
+void ReductionForRuntime(const DataPoint& data);
+void TestSchedStaticNonmonRuntime(const DataPoint& data);
+void TestSchedDynamicNonmonRuntime(const DataPoint& data);
+void TestSchedGuidedNonmonRuntime(const DataPoint& data);
+
+/// @brief Reference serial implementations with iterations and workload as runtime values
+/// @param data the configuration for the reference
+void ReferenceRuntime(const DataPoint& data);
+void ReferenceReductionRuntime(const DataPoint& data);
+
+#endif //PPT_P4_CONSTEXPR_H
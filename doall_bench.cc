@@ -16,6 +16,10 @@ float array_thread_private[ARRAY_SIZE];
 
 std::string bench_name = "DOALL_" + std::to_string(ARRAY_SIZE);
 
+// the number of consecutive loops of the chained tests, and the values passed from one loop to the next
+int chained_loops = 1;
+std::vector<float> chain_values;
+
 
 int main(int argc, char **argv) {
 
@@ -27,6 +31,8 @@ int main(int argc, char **argv) {
         RemoveBench(bench_name);
     }
 
+    chain_values.resize(*std::max_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end()));
+
     RunBenchmarks();
 
     return 0;
@@ -40,6 +46,14 @@ void RunBenchmarks() {
     Benchmark(bench_name, "PRIVATE", TestDoallPrivate, ReferenceWithArray);
     Benchmark(bench_name, "COPYIN", TestCopyin, ReferenceWithArray);
     Benchmark(bench_name, "COPY_PRIVATE", TestCopyPrivate, ReferenceWithArray);
+
+    // the difference of CHAINED_STATIC and CHAINED_NOWAIT divided by k - 1 is the cost of one barrier
+    for (chained_loops = 1; chained_loops <= 16; chained_loops *= 2) {
+        std::string suffix = "_" + std::to_string(chained_loops);
+        Benchmark(bench_name, "CHAINED" + suffix, TestChained, ReferenceChained);
+        Benchmark(bench_name, "CHAINED_STATIC" + suffix, TestChainedStatic, ReferenceChained);
+        Benchmark(bench_name, "CHAINED_NOWAIT" + suffix, TestChainedNowait, ReferenceChained);
+    }
 }
 
 // allocate variables right away to reduce measured work
@@ -146,6 +160,81 @@ void TestCopyPrivate(const DataPoint& data) {
     }
 }
 
+void TestChained(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    int loops = chained_loops;
+    float *values = chain_values.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, loops, values)
+        for (int loop = 0; loop < loops; loop++) {
+            #pragma omp for
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i);
+                values[i] += DELAY_A;
+            }
+        }
+    }
+}
+
+void TestChainedStatic(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    int loops = chained_loops;
+    float *values = chain_values.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, loops, values)
+        for (int loop = 0; loop < loops; loop++) {
+            #pragma omp for schedule(static)
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i);
+                values[i] += DELAY_A;
+            }
+        }
+    }
+}
+
+void TestChainedNowait(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    int loops = chained_loops;
+    float *values = chain_values.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        // only the implicit barrier at the end of the parallel region is left
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, loops, values)
+        for (int loop = 0; loop < loops; loop++) {
+            #pragma omp for schedule(static) nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i);
+                values[i] += DELAY_A;
+            }
+        }
+    }
+}
+
+void ReferenceChained(const DataPoint& data) {
+    threads = data.threads; // not used, only here for equal work in Test and Reference
+    iterations = data.iterations;
+    workload = data.workload;
+    int loops = chained_loops;
+    float *values = chain_values.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int loop = 0; loop < loops; loop++) {
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i);
+                values[i] += DELAY_A;
+            }
+        }
+    }
+}
+
 void ReferenceWithArray(const DataPoint& data) {
     threads = data.threads; // not used, only here for equal work in Test and Reference
     iterations = data.iterations;
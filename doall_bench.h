@@ -31,6 +31,24 @@ void TestCopyin(const DataPoint& data);
 /// @param data the configuration for the microbenchmark
 void TestCopyPrivate(const DataPoint& data);
 
+/// @brief Benchmark for k consecutive worksharing loops in one parallel region, every loop reads the result of the
+/// previous loop for the same iteration, k is set before the test
+/// @param data the configuration for the microbenchmark
+void TestChained(const DataPoint& data);
+
+/// @brief The same as TestChained, with schedule(static) for all loops
+/// @param data the configuration for the microbenchmark
+void TestChainedStatic(const DataPoint& data);
+
+/// @brief The same as TestChainedStatic, with nowait. The static schedules of the loops with the same iteration space
+/// assign every iteration to the same thread, so the barriers between the loops can be left out
+/// @param data the configuration for the microbenchmark
+void TestChainedNowait(const DataPoint& data);
+
+/// @brief Reference Implementation for the chained loops, k serial loops
+/// @param data the configuration for the reference
+void ReferenceChained(const DataPoint& data);
+
 /// @brief Reference Implementation, for calculating the overhead, uses ArrayDelayFunction
 /// @param data the configuration for the reference
 void ReferenceWithArray(const DataPoint& data);
@@ -0,0 +1,344 @@
+#include <omp.h>
+#include <algorithm>
+#include <cmath>
+#include "nested_bench.h"
+#include "commons.h"
+
+std::string bench_name = "NESTED";
+
+// The size of the outer team, the inner teams get threads / outer_threads threads,
+// so that nested and flat benchmarks use the same total amount of threads.
+// Only the numbers of threads which are a multiple of outer_threads are run with it.
+unsigned int outer_threads = 1;
+
+void RunBenchmarks() {
+    unsigned int maximum_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    const std::vector<unsigned int> all_threads = NUMBER_OF_THREADS;
+
+    Benchmark(bench_name, "FLAT_FORK_JOIN", TestFlatForkJoin, Reference);
+    Benchmark(bench_name, "FLAT_BARRIER", TestFlatBarrier, Reference);
+    Benchmark(bench_name, "FLAT_WORKSHARING", TestFlatWorksharing, Reference);
+
+    // with one active level the inner regions are serialized, this shows the cost of an inactive inner region
+    for (int active_levels = 1; active_levels <= 2; active_levels++) {
+        omp_set_max_active_levels(active_levels);
+        std::string levels = "_LEVELS_" + std::to_string(active_levels);
+
+        for (unsigned int outer = 1; outer <= maximum_threads; outer = outer * 2) {
+            outer_threads = outer;
+            std::string outer_name = "_OUTER_" + std::to_string(outer);
+
+            // the other numbers of threads can't be split into outer teams of the same size
+            NUMBER_OF_THREADS.clear();
+            for (unsigned int threads : all_threads) {
+                if (threads % outer == 0) {
+                    NUMBER_OF_THREADS.push_back(threads);
+                } else if (active_levels == 1) {
+                    printf("Skipping %u threads for OUTER_%u, not a multiple of the outer team size\n", threads, outer);
+                }
+            }
+
+            Benchmark(bench_name, "FORK_JOIN" + outer_name + "_SPREAD" + levels, TestNestedForkJoinSpread, Reference);
+            Benchmark(bench_name, "FORK_JOIN" + outer_name + "_CLOSE" + levels, TestNestedForkJoinClose, Reference);
+            Benchmark(bench_name, "FORK_JOIN" + outer_name + "_PRIMARY" + levels, TestNestedForkJoinPrimary, Reference);
+
+            Benchmark(bench_name, "BARRIER" + outer_name + "_SPREAD" + levels, TestNestedBarrierSpread, Reference);
+            Benchmark(bench_name, "BARRIER" + outer_name + "_CLOSE" + levels, TestNestedBarrierClose, Reference);
+            Benchmark(bench_name, "BARRIER" + outer_name + "_PRIMARY" + levels, TestNestedBarrierPrimary, Reference);
+
+            Benchmark(bench_name, "WORKSHARING" + outer_name + "_SPREAD" + levels, TestNestedWorksharingSpread, Reference);
+            Benchmark(bench_name, "WORKSHARING" + outer_name + "_CLOSE" + levels, TestNestedWorksharingClose, Reference);
+            Benchmark(bench_name, "WORKSHARING" + outer_name + "_PRIMARY" + levels, TestNestedWorksharingPrimary, Reference);
+        }
+    }
+    NUMBER_OF_THREADS = all_threads;
+}
+
+void TestFlatForkJoin(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload) default(none)
+        {
+            unsigned int team_size = omp_get_num_threads();
+            for (unsigned long long i = omp_get_thread_num(); i < iterations; i += team_size) {
+                DELAY(workload, i);
+            }
+        }
+    }
+}
+
+void TestFlatBarrier(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(threads) shared(iterations, workload, threads, directive) default(none)
+    {
+        for (int rep = 0; rep < directive; rep++) {
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                DELAY(workload, i);
+                #pragma omp barrier
+            }
+        }
+    }
+}
+
+void TestFlatWorksharing(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(threads) shared(iterations, workload, directive) default(none)
+    {
+        for (int rep = 0; rep < directive; rep++) {
+            #pragma omp for
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i);
+            }
+        }
+    }
+}
+
+void TestNestedForkJoinSpread(const DataPoint& data) {
+    unsigned int outer = outer_threads;
+    unsigned int inner = data.threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, inner) default(none)
+    {
+        unsigned int outer_id = omp_get_thread_num();
+        unsigned int outer_size = omp_get_num_threads();
+
+        for (int rep = 0; rep < directive; rep++) {
+            #pragma omp parallel num_threads(inner) proc_bind(spread) shared(iterations, workload, outer_id, outer_size) default(none)
+            {
+                // the team size is only smaller than inner, if the inner region is inactive
+                unsigned int team_size = omp_get_num_threads();
+                for (unsigned long long i = outer_id * team_size + omp_get_thread_num(); i < iterations; i += outer_size * team_size) {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestNestedForkJoinClose(const DataPoint& data) {
+    unsigned int outer = outer_threads;
+    unsigned int inner = data.threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, inner) default(none)
+    {
+        unsigned int outer_id = omp_get_thread_num();
+        unsigned int outer_size = omp_get_num_threads();
+
+        for (int rep = 0; rep < directive; rep++) {
+            #pragma omp parallel num_threads(inner) proc_bind(close) shared(iterations, workload, outer_id, outer_size) default(none)
+            {
+                unsigned int team_size = omp_get_num_threads();
+                for (unsigned long long i = outer_id * team_size + omp_get_thread_num(); i < iterations; i += outer_size * team_size) {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestNestedForkJoinPrimary(const DataPoint& data) {
+    unsigned int outer = outer_threads;
+    unsigned int inner = data.threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, inner) default(none)
+    {
+        unsigned int outer_id = omp_get_thread_num();
+        unsigned int outer_size = omp_get_num_threads();
+
+        for (int rep = 0; rep < directive; rep++) {
+            #pragma omp parallel num_threads(inner) proc_bind(primary) shared(iterations, workload, outer_id, outer_size) default(none)
+            {
+                unsigned int team_size = omp_get_num_threads();
+                for (unsigned long long i = outer_id * team_size + omp_get_thread_num(); i < iterations; i += outer_size * team_size) {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestNestedBarrierSpread(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned int outer = outer_threads;
+    unsigned int inner = threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, threads, inner) default(none)
+    {
+        #pragma omp parallel num_threads(inner) proc_bind(spread) shared(iterations, workload, directive, threads) default(none)
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                    DELAY(workload, i);
+                    #pragma omp barrier
+                }
+            }
+        }
+    }
+}
+
+void TestNestedBarrierClose(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned int outer = outer_threads;
+    unsigned int inner = threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, threads, inner) default(none)
+    {
+        #pragma omp parallel num_threads(inner) proc_bind(close) shared(iterations, workload, directive, threads) default(none)
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                    DELAY(workload, i);
+                    #pragma omp barrier
+                }
+            }
+        }
+    }
+}
+
+void TestNestedBarrierPrimary(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned int outer = outer_threads;
+    unsigned int inner = threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, threads, inner) default(none)
+    {
+        #pragma omp parallel num_threads(inner) proc_bind(primary) shared(iterations, workload, directive, threads) default(none)
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                    DELAY(workload, i);
+                    #pragma omp barrier
+                }
+            }
+        }
+    }
+}
+
+void TestNestedWorksharingSpread(const DataPoint& data) {
+    unsigned int outer = outer_threads;
+    unsigned int inner = data.threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, inner) default(none)
+    {
+        // every outer thread gets a block of the iterations, which is shared by its inner team
+        unsigned long long begin = iterations * omp_get_thread_num() / omp_get_num_threads();
+        unsigned long long end = iterations * (omp_get_thread_num() + 1) / omp_get_num_threads();
+
+        #pragma omp parallel num_threads(inner) proc_bind(spread) shared(begin, end, workload, directive) default(none)
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                #pragma omp for
+                for (unsigned long long i = begin; i < end; i++) {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestNestedWorksharingClose(const DataPoint& data) {
+    unsigned int outer = outer_threads;
+    unsigned int inner = data.threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, inner) default(none)
+    {
+        unsigned long long begin = iterations * omp_get_thread_num() / omp_get_num_threads();
+        unsigned long long end = iterations * (omp_get_thread_num() + 1) / omp_get_num_threads();
+
+        #pragma omp parallel num_threads(inner) proc_bind(close) shared(begin, end, workload, directive) default(none)
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                #pragma omp for
+                for (unsigned long long i = begin; i < end; i++) {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestNestedWorksharingPrimary(const DataPoint& data) {
+    unsigned int outer = outer_threads;
+    unsigned int inner = data.threads / outer;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    unsigned int directive = data.directive;
+
+    #pragma omp parallel num_threads(outer) shared(iterations, workload, directive, inner) default(none)
+    {
+        unsigned long long begin = iterations * omp_get_thread_num() / omp_get_num_threads();
+        unsigned long long end = iterations * (omp_get_thread_num() + 1) / omp_get_num_threads();
+
+        #pragma omp parallel num_threads(inner) proc_bind(primary) shared(begin, end, workload, directive) default(none)
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                #pragma omp for
+                for (unsigned long long i = begin; i < end; i++) {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+        }
+    }
+}
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
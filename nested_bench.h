@@ -0,0 +1,64 @@
+#ifndef PPT_P4_NESTED_H
+#define PPT_P4_NESTED_H
+
+#include "commons.h"
+
+/// @brief Flat parallel region created for every directive, the iterations are distributed by the thread number
+/// @param data the configuration for the microbenchmark
+void TestFlatForkJoin(const DataPoint& data);
+
+/// @brief Flat parallel region with a barrier after every loop iteration
+/// @param data the configuration for the microbenchmark
+void TestFlatBarrier(const DataPoint& data);
+
+/// @brief Flat parallel region with a worksharing loop for every directive
+/// @param data the configuration for the microbenchmark
+void TestFlatWorksharing(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(spread) created for every directive inside of an outer team,
+/// the iterations are distributed by the thread numbers of both levels
+/// @param data the configuration for the microbenchmark
+void TestNestedForkJoinSpread(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(close) created for every directive inside of an outer team,
+/// the iterations are distributed by the thread numbers of both levels
+/// @param data the configuration for the microbenchmark
+void TestNestedForkJoinClose(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(primary) created for every directive inside of an outer team,
+/// the iterations are distributed by the thread numbers of both levels
+/// @param data the configuration for the microbenchmark
+void TestNestedForkJoinPrimary(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(spread) and a barrier of the inner team after every loop iteration
+/// @param data the configuration for the microbenchmark
+void TestNestedBarrierSpread(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(close) and a barrier of the inner team after every loop iteration
+/// @param data the configuration for the microbenchmark
+void TestNestedBarrierClose(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(primary) and a barrier of the inner team after every loop iteration
+/// @param data the configuration for the microbenchmark
+void TestNestedBarrierPrimary(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(spread), every inner team shares the iterations of its outer thread
+/// with a worksharing loop for every directive
+/// @param data the configuration for the microbenchmark
+void TestNestedWorksharingSpread(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(close), every inner team shares the iterations of its outer thread
+/// with a worksharing loop for every directive
+/// @param data the configuration for the microbenchmark
+void TestNestedWorksharingClose(const DataPoint& data);
+
+/// @brief Inner parallel regions with proc_bind(primary), every inner team shares the iterations of its outer thread
+/// with a worksharing loop for every directive
+/// @param data the configuration for the microbenchmark
+void TestNestedWorksharingPrimary(const DataPoint& data);
+
+/// @brief Reference serial implementation
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+#endif //PPT_P4_NESTED_H
@@ -0,0 +1,531 @@
+#include <algorithm>
+#include <atomic>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "privatization_bench.h"
+#include "commons.h"
+
+// The array sizes (in floats) every kernel gets instantiated for, the same as the ARRAY_SIZE list of doall_bench.
+// The privatization clauses need arrays with a size known at compile time, otherwise just the pointer is privatized.
+#define PRIVATIZATION_ARRAY_SIZES(X) \
+    X(1) X(4) X(16) X(64) X(256) X(1024) X(4096) X(16384) X(65536) X(262144)
+
+#define ARRAY_SIZE_VALUE(SIZE) SIZE,
+const std::vector<unsigned long long> PRIVATIZATION_ARRAY_SIZE_VALUES{PRIVATIZATION_ARRAY_SIZES(ARRAY_SIZE_VALUE)};
+#undef ARRAY_SIZE_VALUE
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+/// @brief Prints how often the constructors, assignments and destructor of CountedObject run per thread
+/// for every privatization clause, with the first array size and number of iterations
+void PrintObjectLifetimes();
+
+std::string bench_name = "PRIVATIZATION";
+
+// the array size of the current benchmark, the kernels are dispatched by it
+unsigned long long array_size = 1;
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (ARRAY_SIZES.empty()) {
+        ARRAY_SIZES = PRIVATIZATION_ARRAY_SIZE_VALUES;
+    }
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    for (unsigned long long size : ARRAY_SIZES) {
+        if (std::find(PRIVATIZATION_ARRAY_SIZE_VALUES.begin(), PRIVATIZATION_ARRAY_SIZE_VALUES.end(), size)
+            == PRIVATIZATION_ARRAY_SIZE_VALUES.end()) {
+            std::cout << "Skipping array size " << size << ", not in PRIVATIZATION_ARRAY_SIZES" << std::endl;
+            continue;
+        }
+        array_size = size;
+
+        // exported in bytes, so that the fitted model directly gives the cost per privatized byte
+        std::vector<Parameter> parameters{{"Bytes", size * sizeof(float)}};
+
+        Benchmark(bench_name, "SHARED", TestPrivatizationShared, ReferenceWithArray, parameters);
+        Benchmark(bench_name, "FIRSTPRIVATE", TestPrivatizationFirstprivate, ReferenceWithArray, parameters);
+        Benchmark(bench_name, "PRIVATE", TestPrivatizationPrivate, ReferenceWithArray, parameters);
+        Benchmark(bench_name, "COPYIN", TestPrivatizationCopyin, ReferenceWithArray, parameters);
+        Benchmark(bench_name, "COPY_PRIVATE", TestPrivatizationCopyPrivate, ReferenceWithArray, parameters);
+        Benchmark(bench_name, "LASTPRIVATE", TestPrivatizationLastprivate, ReferenceWithArray, parameters);
+        Benchmark(bench_name, "DEFAULT_FIRSTPRIVATE", TestPrivatizationDefaultFirstprivate, ReferenceWithArray, parameters);
+
+        // C++ objects, the vector has the same number of floats, the string the same number of bytes as the array
+        Benchmark(bench_name, "VECTOR_SHARED", TestVectorShared, ReferenceWithVector, parameters);
+        Benchmark(bench_name, "VECTOR_FIRSTPRIVATE", TestVectorFirstprivate, ReferenceWithVector, parameters);
+        Benchmark(bench_name, "VECTOR_PRIVATE", TestVectorPrivate, ReferenceWithVector, parameters);
+        Benchmark(bench_name, "VECTOR_LASTPRIVATE", TestVectorLastprivate, ReferenceWithVector, parameters);
+        Benchmark(bench_name, "VECTOR_DEFAULT_FIRSTPRIVATE", TestVectorDefaultFirstprivate, ReferenceWithVector, parameters);
+        Benchmark(bench_name, "STRING_SHARED", TestStringShared, ReferenceWithString, parameters);
+        Benchmark(bench_name, "STRING_FIRSTPRIVATE", TestStringFirstprivate, ReferenceWithString, parameters);
+        Benchmark(bench_name, "STRING_PRIVATE", TestStringPrivate, ReferenceWithString, parameters);
+        Benchmark(bench_name, "STRING_LASTPRIVATE", TestStringLastprivate, ReferenceWithString, parameters);
+        Benchmark(bench_name, "STRING_DEFAULT_FIRSTPRIVATE", TestStringDefaultFirstprivate, ReferenceWithString, parameters);
+        Benchmark(bench_name, "OBJECT_SHARED", TestObjectShared, ReferenceWithObject, parameters);
+        Benchmark(bench_name, "OBJECT_FIRSTPRIVATE", TestObjectFirstprivate, ReferenceWithObject, parameters);
+        Benchmark(bench_name, "OBJECT_PRIVATE", TestObjectPrivate, ReferenceWithObject, parameters);
+        Benchmark(bench_name, "OBJECT_LASTPRIVATE", TestObjectLastprivate, ReferenceWithObject, parameters);
+        Benchmark(bench_name, "OBJECT_DEFAULT_FIRSTPRIVATE", TestObjectDefaultFirstprivate, ReferenceWithObject, parameters);
+    }
+
+    // the scalar clauses don't depend on the array size, Bytes is the size of the scalar
+    std::vector<Parameter> scalar_parameters{{"Bytes", sizeof(float)}};
+    Benchmark(bench_name, "LINEAR", TestPrivatizationLinear, ReferenceWithScalar, scalar_parameters);
+    Benchmark(bench_name, "LASTPRIVATE_CONDITIONAL", TestPrivatizationLastprivateConditional, ReferenceWithScalar, scalar_parameters);
+
+    PrintObjectLifetimes();
+}
+
+// allocate variables right away to reduce measured work
+unsigned int threads;
+unsigned long long int iterations;
+unsigned long workload;
+
+// The kernels have the same loops as in doall_bench, but the array has SIZE floats.
+// The arrays are static, so that they behave like the global arrays of doall_bench.
+
+template<unsigned long SIZE>
+struct FirstprivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) firstprivate(array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct PrivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) private(array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct SharedKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct LastprivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) lastprivate(array)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+// default(firstprivate) does not apply to variables at namespace scope, so iterations and workload stay shared
+template<unsigned long SIZE>
+struct DefaultFirstprivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel for num_threads(threads) default(firstprivate) shared(iterations, workload)
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct CopyPrivateKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload) private(array)
+            {
+                #pragma omp single copyprivate(array)
+                {
+                    for (int i = 0; i < iterations; i++) {
+                        ARRAY_DELAY(workload, i, array);
+                    }
+                }
+            }
+        }
+    }
+};
+
+template<unsigned long SIZE>
+struct ReferenceKernel {
+    static void Run(const DataPoint& data) {
+        static float array[SIZE];
+
+        for (int rep = 0; rep < data.directive; rep++) {
+            for (int i = 0; i < iterations; i++) {
+                ARRAY_DELAY(workload, i, array);
+            }
+        }
+    }
+};
+
+// threadprivate does not accept arrays with a size depending on a template parameter,
+// so the threadprivate arrays and the copyin kernels are generated for every size instead
+template<unsigned long SIZE>
+struct CopyinKernel;
+
+#define DEFINE_COPYIN_KERNEL(SIZE) \
+float array_thread_private_##SIZE[SIZE]; \
+PRAGMA(omp threadprivate(array_thread_private_##SIZE)) \
+template<> \
+struct CopyinKernel<SIZE> { \
+    static void Run(const DataPoint& data) { \
+        for (int rep = 0; rep < data.directive; rep++) { \
+            PRAGMA(omp parallel for num_threads(threads) default(none) copyin(array_thread_private_##SIZE) shared(iterations, workload)) \
+            for (int i = 0; i < iterations; i++) { \
+                ARRAY_DELAY(workload, i, array_thread_private_##SIZE); \
+            } \
+        } \
+    } \
+};
+
+PRIVATIZATION_ARRAY_SIZES(DEFINE_COPYIN_KERNEL)
+#undef DEFINE_COPYIN_KERNEL
+
+template<template<unsigned long> class KERNEL>
+void Dispatch(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+
+    switch (array_size) {
+        #define DISPATCH_ARRAY_SIZE(SIZE) case SIZE: KERNEL<SIZE>::Run(data); break;
+        PRIVATIZATION_ARRAY_SIZES(DISPATCH_ARRAY_SIZE)
+        #undef DISPATCH_ARRAY_SIZE
+        default:
+            printf("No instantiation for array size %llu\n", array_size);
+            exit(-1);
+    }
+}
+
+void TestPrivatizationShared(const DataPoint& data) {
+    Dispatch<SharedKernel>(data);
+}
+
+void TestPrivatizationFirstprivate(const DataPoint& data) {
+    Dispatch<FirstprivateKernel>(data);
+}
+
+void TestPrivatizationPrivate(const DataPoint& data) {
+    Dispatch<PrivateKernel>(data);
+}
+
+void TestPrivatizationCopyin(const DataPoint& data) {
+    Dispatch<CopyinKernel>(data);
+}
+
+void TestPrivatizationCopyPrivate(const DataPoint& data) {
+    Dispatch<CopyPrivateKernel>(data);
+}
+
+void TestPrivatizationLastprivate(const DataPoint& data) {
+    Dispatch<LastprivateKernel>(data);
+}
+
+void TestPrivatizationDefaultFirstprivate(const DataPoint& data) {
+    Dispatch<DefaultFirstprivateKernel>(data);
+}
+
+void ReferenceWithArray(const DataPoint& data) {
+    Dispatch<ReferenceKernel>(data);
+}
+
+void TestPrivatizationLinear(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        unsigned long long index = 0;
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) linear(index)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, index);
+            index++;
+        }
+    }
+}
+
+void TestPrivatizationLastprivateConditional(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float last = 0;
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) lastprivate(conditional: last)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+            if (i % 2 == 0) {
+                last = DELAY_A;
+            }
+        }
+    }
+}
+
+void ReferenceWithScalar(const DataPoint& data) {
+    threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    iterations = data.iterations;
+    workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        unsigned long long index = 0;
+        float last = 0;
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, index);
+            index++;
+            if (i % 2 == 0) {
+                last = DELAY_A;
+            }
+        }
+    }
+}
+
+// Counts the constructions, assignments and destructions of all CountedObjects
+struct LifetimeCounters {
+    std::atomic<unsigned long long> default_constructions{0};
+    std::atomic<unsigned long long> copy_constructions{0};
+    std::atomic<unsigned long long> move_constructions{0};
+    std::atomic<unsigned long long> copy_assignments{0};
+    std::atomic<unsigned long long> move_assignments{0};
+    std::atomic<unsigned long long> destructions{0};
+
+    void Reset() {
+        default_constructions = 0;
+        copy_constructions = 0;
+        move_constructions = 0;
+        copy_assignments = 0;
+        move_assignments = 0;
+        destructions = 0;
+    }
+};
+
+LifetimeCounters lifetime_counters;
+
+/// @brief An object with a heap buffer of the current array size, the copies are deep, like in most containers.
+/// The default constructor allocates the buffer as well, so private is as expensive as firstprivate without the copy
+class CountedObject {
+public:
+    CountedObject() : size(array_size), buffer(new float[array_size]()) {
+        lifetime_counters.default_constructions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CountedObject(const CountedObject &other) : size(other.size), buffer(new float[other.size]) {
+        std::copy(other.buffer, other.buffer + size, buffer);
+        lifetime_counters.copy_constructions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CountedObject(CountedObject &&other) noexcept : size(other.size), buffer(other.buffer) {
+        other.size = 0;
+        other.buffer = nullptr;
+        lifetime_counters.move_constructions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CountedObject &operator=(const CountedObject &other) {
+        if (this != &other) {
+            if (size != other.size) {
+                delete[] buffer;
+                size = other.size;
+                buffer = new float[size];
+            }
+            std::copy(other.buffer, other.buffer + size, buffer);
+        }
+        lifetime_counters.copy_assignments.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+
+    CountedObject &operator=(CountedObject &&other) noexcept {
+        std::swap(size, other.size);
+        std::swap(buffer, other.buffer);
+        lifetime_counters.move_assignments.fetch_add(1, std::memory_order_relaxed);
+        return *this;
+    }
+
+    ~CountedObject() {
+        delete[] buffer;
+        lifetime_counters.destructions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool empty() const {
+        return size == 0;
+    }
+
+    float &operator[](unsigned long long index) {
+        return buffer[index];
+    }
+
+private:
+    unsigned long long size;
+    float *buffer;
+};
+
+// The objects of the current array size, the string has as many bytes as the array
+template<typename T>
+T MakeObject();
+
+template<>
+std::vector<float> MakeObject<std::vector<float>>() {
+    return std::vector<float>(array_size);
+}
+
+template<>
+std::string MakeObject<std::string>() {
+    return std::string(array_size * sizeof(float), 'a');
+}
+
+template<>
+CountedObject MakeObject<CountedObject>() {
+    return CountedObject();
+}
+
+/// @brief Uses the object in every iteration, so that every thread has to use its own copy, the private copies may be empty
+template<typename T>
+ALWAYS_INLINE void Touch(T &object, float value) {
+    if (!object.empty()) {
+        object[0] += value;
+    }
+}
+
+// The clauses are tokens of the directive, so the tests are generated for every type and clause
+#define DEFINE_OBJECT_TEST(NAME, TYPE, CLAUSES) \
+void NAME(const DataPoint& data) { \
+    threads = data.threads; \
+    iterations = data.iterations; \
+    workload = data.workload; \
+    TYPE object = MakeObject<TYPE>(); \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel for num_threads(threads) CLAUSES) \
+        for (int i = 0; i < iterations; i++) { \
+            DELAY(workload, i); \
+            Touch(object, DELAY_A); \
+        } \
+    } \
+}
+
+#define DEFINE_OBJECT_TESTS(PREFIX, TYPE) \
+DEFINE_OBJECT_TEST(Test##PREFIX##Shared, TYPE, default(none) shared(iterations, workload, object)) \
+DEFINE_OBJECT_TEST(Test##PREFIX##Firstprivate, TYPE, default(none) shared(iterations, workload) firstprivate(object)) \
+DEFINE_OBJECT_TEST(Test##PREFIX##Private, TYPE, default(none) shared(iterations, workload) private(object)) \
+DEFINE_OBJECT_TEST(Test##PREFIX##Lastprivate, TYPE, default(none) shared(iterations, workload) lastprivate(object)) \
+DEFINE_OBJECT_TEST(Test##PREFIX##DefaultFirstprivate, TYPE, default(firstprivate) shared(iterations, workload))
+
+DEFINE_OBJECT_TESTS(Vector, std::vector<float>)
+DEFINE_OBJECT_TESTS(String, std::string)
+DEFINE_OBJECT_TESTS(Object, CountedObject)
+#undef DEFINE_OBJECT_TESTS
+#undef DEFINE_OBJECT_TEST
+
+template<typename T>
+void ReferenceObjectKernel(const DataPoint& data) {
+    threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    iterations = data.iterations;
+    workload = data.workload;
+    T object = MakeObject<T>();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+            Touch(object, DELAY_A);
+        }
+    }
+}
+
+void ReferenceWithVector(const DataPoint& data) {
+    ReferenceObjectKernel<std::vector<float>>(data);
+}
+
+void ReferenceWithString(const DataPoint& data) {
+    ReferenceObjectKernel<std::string>(data);
+}
+
+void ReferenceWithObject(const DataPoint& data) {
+    ReferenceObjectKernel<CountedObject>(data);
+}
+
+void PrintObjectLifetimes() {
+    if (QUIET || ARRAY_SIZES.empty()) {
+        return;
+    }
+
+    const std::vector<std::pair<std::string, void (*)(const DataPoint&)>> clauses = {
+            {"SHARED", TestObjectShared},
+            {"FIRSTPRIVATE", TestObjectFirstprivate},
+            {"PRIVATE", TestObjectPrivate},
+            {"LASTPRIVATE", TestObjectLastprivate},
+            {"DEFAULT_FIRSTPRIVATE", TestObjectDefaultFirstprivate},
+    };
+
+    DataPoint data{};
+    data.iterations = NUMBER_OF_ITERATIONS.at(0);
+    data.workload = 0;
+    data.directive = 1;
+    array_size = ARRAY_SIZES.at(0);
+
+    std::cout << "Name of test: OBJECT_LIFETIMES" << std::endl;
+    std::cout << "Iterations: " << data.iterations << ", Object size in bytes: " << array_size * sizeof(float)
+              << ", calls per thread" << std::endl;
+    std::cout << "Clause               | Threads | Default ctor | Copy ctor | Move ctor | Copy assign | Move assign |     Dtor" << std::endl;
+
+    for (const auto &clause : clauses) {
+        for (unsigned int threads : NUMBER_OF_THREADS) {
+            data.threads = threads;
+            lifetime_counters.Reset();
+            clause.second(data);
+
+            // the original object of the test is not counted
+            double per_thread = 1.0 / threads;
+            std::cout << std::left << std::setw(20) << clause.first << std::right << std::fixed << std::setprecision(2)
+                      << " | " << std::setw(7) << threads
+                      << " | " << std::setw(12) << (lifetime_counters.default_constructions - 1) * per_thread
+                      << " | " << std::setw(9) << lifetime_counters.copy_constructions * per_thread
+                      << " | " << std::setw(9) << lifetime_counters.move_constructions * per_thread
+                      << " | " << std::setw(11) << lifetime_counters.copy_assignments * per_thread
+                      << " | " << std::setw(11) << lifetime_counters.move_assignments * per_thread
+                      << " | " << std::setw(8) << (lifetime_counters.destructions - 1) * per_thread << std::endl;
+        }
+    }
+}
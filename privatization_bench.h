@@ -0,0 +1,81 @@
+#ifndef PPT_P4_PRIVATIZATION_H
+#define PPT_P4_PRIVATIZATION_H
+
+#include "commons.h"
+
+/// @brief Benchmark for an array of the current array size in combination with the shared clause
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationShared(const DataPoint& data);
+
+/// @brief Benchmark for an array of the current array size in combination with the firstprivate clause
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationFirstprivate(const DataPoint& data);
+
+/// @brief Benchmark for an array of the current array size in combination with the private clause
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationPrivate(const DataPoint& data);
+
+/// @brief Benchmark for an array of the current array size in combination with the copyin clause
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationCopyin(const DataPoint& data);
+
+/// @brief Benchmark for an array of the current array size in combination with the copyprivate clause, only works in a single construct
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationCopyPrivate(const DataPoint& data);
+
+/// @brief Benchmark for an array of the current array size in combination with the lastprivate clause
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationLastprivate(const DataPoint& data);
+
+/// @brief Benchmark for an array of the current array size in combination with default(firstprivate) (OpenMP 5.1)
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationDefaultFirstprivate(const DataPoint& data);
+
+/// @brief Benchmark for a scalar in combination with the linear clause, every iteration advances it by one
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationLinear(const DataPoint& data);
+
+/// @brief Benchmark for a scalar in combination with lastprivate(conditional:), it is only assigned in every second iteration
+/// @param data the configuration for the microbenchmark
+void TestPrivatizationLastprivateConditional(const DataPoint& data);
+
+/// @brief Benchmarks for a std::vector<float> with the current array size in combination with the privatization clauses
+/// @param data the configuration for the microbenchmark
+void TestVectorShared(const DataPoint& data);
+void TestVectorFirstprivate(const DataPoint& data);
+void TestVectorPrivate(const DataPoint& data);
+void TestVectorLastprivate(const DataPoint& data);
+void TestVectorDefaultFirstprivate(const DataPoint& data);
+
+/// @brief Benchmarks for a std::string with as many bytes as the current array in combination with the privatization clauses
+/// @param data the configuration for the microbenchmark
+void TestStringShared(const DataPoint& data);
+void TestStringFirstprivate(const DataPoint& data);
+void TestStringPrivate(const DataPoint& data);
+void TestStringLastprivate(const DataPoint& data);
+void TestStringDefaultFirstprivate(const DataPoint& data);
+
+/// @brief Benchmarks for an object with a heap buffer of the current array size and expensive (deep) copy constructor and
+/// copy assignment in combination with the privatization clauses
+/// @param data the configuration for the microbenchmark
+void TestObjectShared(const DataPoint& data);
+void TestObjectFirstprivate(const DataPoint& data);
+void TestObjectPrivate(const DataPoint& data);
+void TestObjectLastprivate(const DataPoint& data);
+void TestObjectDefaultFirstprivate(const DataPoint& data);
+
+/// @brief Reference Implementation, for calculating the overhead, uses an array of the current array size
+/// @param data the configuration for the reference
+void ReferenceWithArray(const DataPoint& data);
+
+/// @brief Reference Implementation for the scalar tests, advances and assigns the scalar like the tests
+/// @param data the configuration for the reference
+void ReferenceWithScalar(const DataPoint& data);
+
+/// @brief Reference Implementations for the object tests, use one object of the type of the tests
+/// @param data the configuration for the reference
+void ReferenceWithVector(const DataPoint& data);
+void ReferenceWithString(const DataPoint& data);
+void ReferenceWithObject(const DataPoint& data);
+
+#endif //PPT_P4_PRIVATIZATION_H
@@ -0,0 +1,420 @@
+#include <omp.h>
+#include <algorithm>
+#include <cfloat>
+#include <complex>
+#include <cstdlib>
+#include "reduction_array_bench.h"
+#include "commons.h"
+
+#define CACHE_LINE_SIZE 64
+#define HISTOGRAM_BINS 64
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+std::string bench_name = "REDUCTION_ARRAY";
+
+// the number of reduced array elements of the current benchmark
+unsigned long long elements = 1;
+
+// the array of the array section reductions
+std::vector<float> reduction_array;
+
+// memory for the padded per-thread partials of all comparators, every thread starts at a cache line
+char *partial_buffer;
+
+struct Histogram {
+    unsigned int bins[HISTOGRAM_BINS];
+};
+
+struct MinLoc {
+    float value;
+    long long index;
+};
+
+Histogram MergeHistograms(const Histogram &out, const Histogram &in) {
+    Histogram merged = out;
+    for (int bin = 0; bin < HISTOGRAM_BINS; bin++) {
+        merged.bins[bin] += in.bins[bin];
+    }
+    return merged;
+}
+
+MinLoc MinOf(const MinLoc &out, const MinLoc &in) {
+    return in.value < out.value || (in.value == out.value && in.index < out.index) ? in : out;
+}
+
+MinLoc InitialMinLoc() {
+    return MinLoc{FLT_MAX, -1};
+}
+
+float AddFloat(const float &out, const float &in) {
+    return out + in;
+}
+
+std::complex<double> AddComplex(const std::complex<double> &out, const std::complex<double> &in) {
+    return out + in;
+}
+
+#pragma omp declare reduction(merge : Histogram : omp_out = MergeHistograms(omp_out, omp_in)) initializer(omp_priv = Histogram())
+#pragma omp declare reduction(minloc : MinLoc : omp_out = MinOf(omp_out, omp_in)) initializer(omp_priv = InitialMinLoc())
+#pragma omp declare reduction(complex_sum : std::complex<double> : omp_out += omp_in) initializer(omp_priv = std::complex<double>(0, 0))
+
+/// @brief The number of elements of type T per thread, so that count elements fit and the next thread starts at a cache line
+template<typename T>
+unsigned long long PaddedCount(unsigned long long count) {
+    return (count * sizeof(T) + CACHE_LINE_SIZE - 1) / CACHE_LINE_SIZE * CACHE_LINE_SIZE / sizeof(T);
+}
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (ARRAY_SIZES.empty()) {
+        for (unsigned long long size = 1; size <= 1048576; size = size * 4) {
+            ARRAY_SIZES.push_back(size);
+        }
+    }
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    unsigned long long max_elements = *std::max_element(ARRAY_SIZES.begin(), ARRAY_SIZES.end());
+    unsigned int max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    reduction_array.resize(max_elements);
+
+    // the largest partials per thread are either the array or a histogram
+    unsigned long long bytes_per_thread = std::max(PaddedCount<float>(max_elements) * sizeof(float),
+                                                   PaddedCount<Histogram>(1) * sizeof(Histogram));
+    partial_buffer = (char *) aligned_alloc(CACHE_LINE_SIZE, max_threads * bytes_per_thread);
+
+    RunBenchmarks();
+
+    free(partial_buffer);
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    for (unsigned long long size : ARRAY_SIZES) {
+        elements = size;
+        std::vector<Parameter> parameters{{"Elements", size}};
+        Benchmark(bench_name, "ARRAY_SECTION", TestReductionArraySection, ReferenceArray, parameters);
+        Benchmark(bench_name, "ARRAY_PADDED_TREE", TestReductionArrayPaddedTree, ReferenceArray, parameters);
+    }
+
+    // the number of reduced values per thread is exported as Elements for all other reductions as well
+    Benchmark(bench_name, "HISTOGRAM_UDR", TestReductionHistogramUdr, ReferenceHistogram, {{"Elements", HISTOGRAM_BINS}});
+    Benchmark(bench_name, "HISTOGRAM_PADDED_TREE", TestReductionHistogramPaddedTree, ReferenceHistogram, {{"Elements", HISTOGRAM_BINS}});
+    Benchmark(bench_name, "MINLOC_UDR", TestReductionMinLocUdr, ReferenceMinLoc, {{"Elements", 1}});
+    Benchmark(bench_name, "MINLOC_PADDED_TREE", TestReductionMinLocPaddedTree, ReferenceMinLoc, {{"Elements", 1}});
+    Benchmark(bench_name, "COMPLEX_UDR", TestReductionComplexUdr, ReferenceComplex, {{"Elements", 1}});
+    Benchmark(bench_name, "COMPLEX_PADDED_TREE", TestReductionComplexPaddedTree, ReferenceComplex, {{"Elements", 1}});
+
+    Benchmark(bench_name, "MANY_VARIABLES_1", TestReductionManyVariables1, ReferenceManyVariables1, {{"Elements", 1}});
+    Benchmark(bench_name, "MANY_VARIABLES_4", TestReductionManyVariables4, ReferenceManyVariables4, {{"Elements", 4}});
+    Benchmark(bench_name, "MANY_VARIABLES_16", TestReductionManyVariables16, ReferenceManyVariables16, {{"Elements", 16}});
+    Benchmark(bench_name, "MANY_VARIABLES_64", TestReductionManyVariables64, ReferenceManyVariables64, {{"Elements", 64}});
+}
+
+/// @brief Log-depth combine of the per-thread partials, called by all threads of the team after their partials are complete.
+/// In every step the threads with an index divisible by 2 * distance combine the partials of the thread at index + distance.
+/// Afterwards the partials of thread 0 contain the result
+/// @param partials the partials of all threads, stride elements per thread
+/// @param count the number of used elements per thread
+template<typename T>
+void TreeCombine(T *partials, unsigned long long stride, unsigned long long count, T (*combine)(const T&, const T&)) {
+    int thread = omp_get_thread_num();
+    int num_threads = omp_get_num_threads();
+
+    for (int distance = 1; distance < num_threads; distance = distance * 2) {
+        #pragma omp barrier
+        if (thread % (2 * distance) == 0 && thread + distance < num_threads) {
+            T *own = partials + thread * stride;
+            T *other = partials + (thread + distance) * stride;
+            for (unsigned long long element = 0; element < count; element++) {
+                own[element] = combine(own[element], other[element]);
+            }
+        }
+    }
+}
+
+void TestReductionArraySection(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *array = reduction_array.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, elements) reduction(+ : array[0:elements])
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            array[i % elements] += DELAY_A;
+        }
+    }
+}
+
+void TestReductionArrayPaddedTree(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *array = reduction_array.data();
+    float *partials = (float *) partial_buffer;
+    unsigned long long stride = PaddedCount<float>(elements);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, elements, array, partials, stride)
+        {
+            float *own = partials + omp_get_thread_num() * stride;
+            for (unsigned long long element = 0; element < elements; element++) {
+                own[element] = 0;
+            }
+
+            // the first step of the tree starts with a barrier
+            #pragma omp for nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                own[i % elements] += DELAY_A;
+            }
+
+            TreeCombine(partials, stride, elements, AddFloat);
+
+            #pragma omp master
+            {
+                for (unsigned long long element = 0; element < elements; element++) {
+                    array[element] += partials[element];
+                }
+            }
+        }
+    }
+}
+
+void TestReductionHistogramUdr(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        Histogram histogram = Histogram();
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) reduction(merge : histogram)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            histogram.bins[i % HISTOGRAM_BINS]++;
+        }
+    }
+}
+
+void TestReductionHistogramPaddedTree(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    Histogram *partials = (Histogram *) partial_buffer;
+    unsigned long long stride = PaddedCount<Histogram>(1);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        Histogram histogram = Histogram();
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, partials, stride, histogram)
+        {
+            Histogram *own = partials + omp_get_thread_num() * stride;
+            *own = Histogram();
+
+            #pragma omp for nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                own->bins[i % HISTOGRAM_BINS]++;
+            }
+
+            TreeCombine(partials, stride, 1, MergeHistograms);
+
+            #pragma omp master
+            histogram = MergeHistograms(histogram, partials[0]);
+        }
+    }
+}
+
+void TestReductionMinLocUdr(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        MinLoc min_loc = InitialMinLoc();
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) reduction(minloc : min_loc)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            min_loc = MinOf(min_loc, MinLoc{(float) ((i * 7919ULL) % 1009), i});
+        }
+    }
+}
+
+void TestReductionMinLocPaddedTree(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    MinLoc *partials = (MinLoc *) partial_buffer;
+    unsigned long long stride = PaddedCount<MinLoc>(1);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        MinLoc min_loc = InitialMinLoc();
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, partials, stride, min_loc)
+        {
+            MinLoc *own = partials + omp_get_thread_num() * stride;
+            *own = InitialMinLoc();
+
+            #pragma omp for nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                *own = MinOf(*own, MinLoc{(float) ((i * 7919ULL) % 1009), i});
+            }
+
+            TreeCombine(partials, stride, 1, MinOf);
+
+            #pragma omp master
+            min_loc = MinOf(min_loc, partials[0]);
+        }
+    }
+}
+
+void TestReductionComplexUdr(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        std::complex<double> sum(0, 0);
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload) reduction(complex_sum : sum)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            sum += std::complex<double>(DELAY_A, i);
+        }
+    }
+}
+
+void TestReductionComplexPaddedTree(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    std::complex<double> *partials = (std::complex<double> *) partial_buffer;
+    unsigned long long stride = PaddedCount<std::complex<double>>(1);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        std::complex<double> sum(0, 0);
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, partials, stride, sum)
+        {
+            std::complex<double> *own = partials + omp_get_thread_num() * stride;
+            *own = std::complex<double>(0, 0);
+
+            #pragma omp for nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                *own += std::complex<double>(DELAY_A, i);
+            }
+
+            TreeCombine(partials, stride, 1, AddComplex);
+
+            #pragma omp master
+            sum += partials[0];
+        }
+    }
+}
+
+// The variables of the many variables reductions are generated with REPEAT_<COUNT>, the names are the base 4 digits of their index
+#define REPEAT_1(X, NAME) X(NAME##0)
+#define REPEAT_4(X, NAME) X(NAME##0) X(NAME##1) X(NAME##2) X(NAME##3)
+#define REPEAT_16(X, NAME) REPEAT_4(X, NAME##0) REPEAT_4(X, NAME##1) REPEAT_4(X, NAME##2) REPEAT_4(X, NAME##3)
+#define REPEAT_64(X, NAME) REPEAT_16(X, NAME##0) REPEAT_16(X, NAME##1) REPEAT_16(X, NAME##2) REPEAT_16(X, NAME##3)
+
+#define DECLARE_VARIABLE(NAME) float NAME = 0;
+#define REDUCTION_CLAUSE(NAME) reduction(+ : NAME)
+#define ACCUMULATE_VARIABLE(NAME) NAME += DELAY_A;
+
+#define DEFINE_MANY_VARIABLES(COUNT) \
+void TestReductionManyVariables##COUNT(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    for (int rep = 0; rep < data.directive; rep++) { \
+        REPEAT_##COUNT(DECLARE_VARIABLE, var_) \
+        PRAGMA(omp parallel for num_threads(threads) default(none) shared(iterations, workload) REPEAT_##COUNT(REDUCTION_CLAUSE, var_)) \
+        for (int i = 0; i < iterations; i++) { \
+            DELAY(workload, i) \
+            REPEAT_##COUNT(ACCUMULATE_VARIABLE, var_) \
+        } \
+    } \
+} \
+void ReferenceManyVariables##COUNT(const DataPoint& data) { \
+    unsigned int threads = data.threads; /* not used, only here for equal amount of work in Test and Reference */ \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    for (int rep = 0; rep < data.directive; rep++) { \
+        REPEAT_##COUNT(DECLARE_VARIABLE, var_) \
+        for (int i = 0; i < iterations; i++) { \
+            DELAY(workload, i) \
+            REPEAT_##COUNT(ACCUMULATE_VARIABLE, var_) \
+        } \
+    } \
+}
+
+DEFINE_MANY_VARIABLES(1)
+DEFINE_MANY_VARIABLES(4)
+DEFINE_MANY_VARIABLES(16)
+DEFINE_MANY_VARIABLES(64)
+
+void ReferenceArray(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *array = reduction_array.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            array[i % elements] += DELAY_A;
+        }
+    }
+}
+
+void ReferenceHistogram(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        Histogram histogram = Histogram();
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            histogram.bins[i % HISTOGRAM_BINS]++;
+        }
+    }
+}
+
+void ReferenceMinLoc(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        MinLoc min_loc = InitialMinLoc();
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            min_loc = MinOf(min_loc, MinLoc{(float) ((i * 7919ULL) % 1009), i});
+        }
+    }
+}
+
+void ReferenceComplex(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        std::complex<double> sum(0, 0);
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            sum += std::complex<double>(DELAY_A, i);
+        }
+    }
+}
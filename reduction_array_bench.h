@@ -0,0 +1,69 @@
+#ifndef PPT_P4_REDUCTION_ARRAY_H
+#define PPT_P4_REDUCTION_ARRAY_H
+
+#include "commons.h"
+
+/// @brief DoAll loop with a reduction over an array section of elements floats, every iteration adds to one element
+/// @param data the configuration for the microbenchmark
+void TestReductionArraySection(const DataPoint& data);
+
+/// @brief The same as TestReductionArraySection, but with manual per-thread partial arrays padded to a cache line
+/// and a log-depth tree combine
+/// @param data the configuration for the microbenchmark
+void TestReductionArrayPaddedTree(const DataPoint& data);
+
+/// @brief DoAll loop with a user-defined reduction (declare reduction) of a histogram struct
+/// @param data the configuration for the microbenchmark
+void TestReductionHistogramUdr(const DataPoint& data);
+
+/// @brief The same as TestReductionHistogramUdr, but with manual padded per-thread histograms and a tree combine
+/// @param data the configuration for the microbenchmark
+void TestReductionHistogramPaddedTree(const DataPoint& data);
+
+/// @brief DoAll loop with a user-defined reduction of the minimum value and its index
+/// @param data the configuration for the microbenchmark
+void TestReductionMinLocUdr(const DataPoint& data);
+
+/// @brief The same as TestReductionMinLocUdr, but with manual padded per-thread partials and a tree combine
+/// @param data the configuration for the microbenchmark
+void TestReductionMinLocPaddedTree(const DataPoint& data);
+
+/// @brief DoAll loop with a user-defined sum of std::complex<double>
+/// @param data the configuration for the microbenchmark
+void TestReductionComplexUdr(const DataPoint& data);
+
+/// @brief The same as TestReductionComplexUdr, but with manual padded per-thread partials and a tree combine
+/// @param data the configuration for the microbenchmark
+void TestReductionComplexPaddedTree(const DataPoint& data);
+
+/// @brief DoAll loop with 1, 4, 16 or 64 float variables in reduction clauses at the same time
+/// @param data the configuration for the microbenchmark
+void TestReductionManyVariables1(const DataPoint& data);
+void TestReductionManyVariables4(const DataPoint& data);
+void TestReductionManyVariables16(const DataPoint& data);
+void TestReductionManyVariables64(const DataPoint& data);
+
+/// @brief Reference implementation for the array reductions, serial aggregation into the array
+/// @param data the configuration for the reference
+void ReferenceArray(const DataPoint& data);
+
+/// @brief Reference implementation for the histogram reductions
+/// @param data the configuration for the reference
+void ReferenceHistogram(const DataPoint& data);
+
+/// @brief Reference implementation for the min-loc reductions
+/// @param data the configuration for the reference
+void ReferenceMinLoc(const DataPoint& data);
+
+/// @brief Reference implementation for the complex reductions
+/// @param data the configuration for the reference
+void ReferenceComplex(const DataPoint& data);
+
+/// @brief Reference implementations for the reductions of many variables, serial aggregation of all variables
+/// @param data the configuration for the reference
+void ReferenceManyVariables1(const DataPoint& data);
+void ReferenceManyVariables4(const DataPoint& data);
+void ReferenceManyVariables16(const DataPoint& data);
+void ReferenceManyVariables64(const DataPoint& data);
+
+#endif //PPT_P4_REDUCTION_ARRAY_H
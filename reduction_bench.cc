@@ -1,4 +1,11 @@
+#include <omp.h>
 #include <algorithm>
+#include <complex>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
 #include "commons.h"
 #include "reduction_bench.h"
 
@@ -9,6 +16,186 @@ std::string bench_name = "REDUCTION";
 unsigned long long num_tasks = 1;
 unsigned long long grainsize = 1;
 
+// The operator and type of the reductions are exported as Extra-P parameters, Extra-P only knows numbers,
+// so they are exported with these codes. All other tests are exported with the + operator on float
+enum ReductionOperator { SUM, PRODUCT, MIN, MAX, BIT_AND, BIT_OR, BIT_XOR, LOGICAL_AND, LOGICAL_OR };
+enum ReductionType { INT32, INT64, FLOAT, DOUBLE, COMPLEX };
+
+const std::vector<std::string> OPERATOR_NAMES{"+", "*", "min", "max", "&", "|", "^", "&&", "||"};
+const std::vector<std::string> TYPE_NAMES{"int32", "int64", "float", "double", "std::complex<double>"};
+
+/// @brief The Extra-P parameters of a reduction with the given operator and type
+std::vector<Parameter> ReductionParameters(ReductionOperator reduction_operator, ReductionType type) {
+    return {{"Operator", (unsigned long long) reduction_operator}, {"Type", (unsigned long long) type}};
+}
+
+#define CACHE_LINE_SIZE 64
+
+/// @brief A partial of the hand-written reductions, every partial is on its own cache line
+struct alignas(CACHE_LINE_SIZE) PaddedPartial {
+    float value;
+};
+
+/// @brief The places of the threads of a team, queried before the benchmarks so that the NUMA-aware comparators
+/// don't measure it. The threads of a team get the same places in every parallel region with OMP_PROC_BIND
+struct PlaceLayout {
+    std::vector<int> place_members; // the threads sorted by place, the threads of a place are contiguous
+    std::vector<int> place_first;   // per thread: the index in place_members of the first thread of its place
+    std::vector<int> place_size;    // per thread: the number of threads of its place
+    std::vector<int> place_rank;    // per thread: the index of the thread in its place
+    std::vector<int> leader_index;  // per thread: the index in leaders, -1 if the thread is no leader
+    std::vector<int> leaders;       // the first thread of every place, it combines the partials of the place
+    int max_place_size = 0;
+};
+
+/// @brief Queries the places of a team with team_size threads
+PlaceLayout ComputePlaceLayout(unsigned int team_size);
+
+// the partials of the hand-written reductions, one per thread, and the place layout of every number of threads
+PaddedPartial *padded_partials;
+std::map<unsigned int, PlaceLayout> place_layouts;
+
+/// @brief Prints which operator and type belongs to which parameter value
+void PrintParameterLegend();
+
+/// @brief Runs the for, task, taskgroup and taskloop reductions of the operator KERNELS for the type T
+template<template<typename> class KERNELS, typename T>
+void RunReductionMatrix(ReductionOperator reduction_operator, ReductionType type);
+
+/// @brief Runs only the for reduction of the operator KERNELS for the type T, the task reductions are not instantiated
+template<template<typename> class KERNELS, typename T>
+void RunReductionMatrixFor(ReductionOperator reduction_operator, ReductionType type);
+
+// allocate variables right away to reduce measured work
+unsigned int threads;
+unsigned long long int iterations;
+unsigned long workload;
+unsigned long directive;
+
+// std::complex is no arithmetic type, + and * are user-defined reductions
+#pragma omp declare reduction(+ : std::complex<double> : omp_out += omp_in) initializer(omp_priv = std::complex<double>(0, 0))
+#pragma omp declare reduction(* : std::complex<double> : omp_out *= omp_in) initializer(omp_priv = std::complex<double>(1, 0))
+
+/// @brief The value aggregated in iteration i, 1 and -1 in every 64th iteration, so that the products of the integer
+/// types never overflow (signed overflow is undefined) and the sign still changes
+template<typename T>
+T ReductionValue(int i) {
+    return T(i % 64 == 63 ? -1 : 1);
+}
+
+// The for, task, taskgroup and taskloop reductions of one operator, the same as ReductionFor, ReductionTask,
+// ReductionTaskgroup and ReductionTaskloop. The reduction identifier has to be a token of the directive,
+// so the kernels are generated for every operator.
+// IDENTITY is the initial value of the variable, COMBINE(VAR, VALUE) aggregates VALUE into VAR
+#define DEFINE_REDUCTION_KERNELS(NAME, OPERATOR, IDENTITY, COMBINE) \
+template<typename T> \
+struct NAME { \
+    static void For(const DataPoint& data) { \
+        threads = data.threads; \
+        iterations = data.iterations; \
+        workload = data.workload; \
+        for (int rep = 0; rep < data.directive; rep++) { \
+            T var = IDENTITY; \
+            PRAGMA(omp parallel for reduction(OPERATOR : var) shared(iterations, workload) default(none) num_threads(threads)) \
+            for (int i = 0; i < iterations; i++) { \
+                DELAY(workload, i) \
+                COMBINE(var, ReductionValue<T>(i)); \
+            } \
+        } \
+    } \
+    static void Task(const DataPoint& data) { \
+        threads = data.threads; \
+        iterations = data.iterations; \
+        workload = data.workload; \
+        for (int rep = 0; rep < data.directive; rep++) { \
+            T var = IDENTITY; \
+            PRAGMA(omp parallel for reduction(task, OPERATOR : var) shared(iterations, workload) default(none) num_threads(threads)) \
+            for (int i = 0; i < iterations; i++) { \
+                PRAGMA(omp task in_reduction(OPERATOR : var) default(none) firstprivate(i) shared(workload)) \
+                { \
+                    DELAY(workload, i) \
+                    COMBINE(var, ReductionValue<T>(i)); \
+                } \
+            } \
+        } \
+    } \
+    static void Taskgroup(const DataPoint& data) { \
+        threads = data.threads; \
+        iterations = data.iterations; \
+        workload = data.workload; \
+        directive = data.directive; \
+        PRAGMA(omp parallel shared(iterations, workload, directive) default(none) num_threads(threads)) \
+        { \
+            PRAGMA(omp master) \
+            { \
+                for (int rep = 0; rep < directive; rep++) { \
+                    T var = IDENTITY; \
+                    PRAGMA(omp taskgroup task_reduction(OPERATOR : var)) \
+                    for (int i = 0; i < iterations; i++) { \
+                        PRAGMA(omp task in_reduction(OPERATOR : var) default(none) firstprivate(i) shared(workload)) \
+                        { \
+                            DELAY(workload, i) \
+                            COMBINE(var, ReductionValue<T>(i)); \
+                        } \
+                    } \
+                } \
+            } \
+        } \
+    } \
+    static void Taskloop(const DataPoint& data) { \
+        threads = data.threads; \
+        iterations = data.iterations; \
+        workload = data.workload; \
+        directive = data.directive; \
+        PRAGMA(omp parallel default(none) shared(directive, iterations, workload) num_threads(threads)) \
+        { \
+            PRAGMA(omp master) \
+            { \
+                for (int rep = 0; rep < directive; rep++) { \
+                    T var = IDENTITY; \
+                    PRAGMA(omp taskloop reduction(OPERATOR : var) shared(iterations, workload) default(none)) \
+                    for (int i = 0; i < iterations; i++) { \
+                        DELAY(workload, i) \
+                        COMBINE(var, ReductionValue<T>(i)); \
+                    } \
+                } \
+            } \
+        } \
+    } \
+    static void Reference(const DataPoint& data) { \
+        threads = data.threads; /* not used, only here for equal amount of work in Test and Reference */ \
+        iterations = data.iterations; \
+        workload = data.workload; \
+        for (int rep = 0; rep < data.directive; rep++) { \
+            T var = IDENTITY; \
+            for (int i = 0; i < iterations; i++) { \
+                DELAY(workload, i) \
+                COMBINE(var, ReductionValue<T>(i)); \
+            } \
+        } \
+    } \
+};
+
+#define COMBINE_SUM(VAR, VALUE) VAR = VAR + VALUE
+#define COMBINE_PRODUCT(VAR, VALUE) VAR = VAR * VALUE
+#define COMBINE_MIN(VAR, VALUE) VAR = VALUE < VAR ? VALUE : VAR
+#define COMBINE_MAX(VAR, VALUE) VAR = VALUE > VAR ? VALUE : VAR
+#define COMBINE_BIT_AND(VAR, VALUE) VAR = VAR & VALUE
+#define COMBINE_BIT_OR(VAR, VALUE) VAR = VAR | VALUE
+#define COMBINE_BIT_XOR(VAR, VALUE) VAR = VAR ^ VALUE
+#define COMBINE_LOGICAL_AND(VAR, VALUE) VAR = VAR && VALUE
+#define COMBINE_LOGICAL_OR(VAR, VALUE) VAR = VAR || VALUE
+
+DEFINE_REDUCTION_KERNELS(SumKernels, +, T(0), COMBINE_SUM)
+DEFINE_REDUCTION_KERNELS(ProductKernels, *, T(1), COMBINE_PRODUCT)
+DEFINE_REDUCTION_KERNELS(MinKernels, min, std::numeric_limits<T>::max(), COMBINE_MIN)
+DEFINE_REDUCTION_KERNELS(MaxKernels, max, std::numeric_limits<T>::lowest(), COMBINE_MAX)
+DEFINE_REDUCTION_KERNELS(BitAndKernels, &, T(~0), COMBINE_BIT_AND)
+DEFINE_REDUCTION_KERNELS(BitOrKernels, |, T(0), COMBINE_BIT_OR)
+DEFINE_REDUCTION_KERNELS(BitXorKernels, ^, T(0), COMBINE_BIT_XOR)
+DEFINE_REDUCTION_KERNELS(LogicalAndKernels, &&, T(1), COMBINE_LOGICAL_AND)
+DEFINE_REDUCTION_KERNELS(LogicalOrKernels, ||, T(0), COMBINE_LOGICAL_OR)
+
 int main(int argc, char **argv) {
 
     ParseArgs(argc, argv);
@@ -19,35 +206,120 @@ int main(int argc, char **argv) {
         RemoveBench(bench_name);
     }
 
+    unsigned int max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    padded_partials = (PaddedPartial *) aligned_alloc(CACHE_LINE_SIZE, max_threads * sizeof(PaddedPartial));
+    for (unsigned int team_size : NUMBER_OF_THREADS) {
+        place_layouts[team_size] = ComputePlaceLayout(team_size);
+    }
+
     RunBenchmarks();
 
+    free(padded_partials);
+
     return 0;
 }
 
 void RunBenchmarks() {
     unsigned long long minimum_iterations = *std::min_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end());
+    std::vector<Parameter> parameters = ReductionParameters(SUM, FLOAT);
+
+    PrintParameterLegend();
 
     for (unsigned long long i = 1; i <= minimum_iterations; i = i * 2) {
         num_tasks = i;
         grainsize = i;
         Benchmark(bench_name, "TASKLOOP_NUM_TASKS_" + std::to_string(num_tasks), ReductionTaskloopNumTasks,
-                  Reference);
+                  Reference, parameters);
         Benchmark(bench_name, "TASKLOOP_GRAINSIZE_" + std::to_string(grainsize), ReductionTaskloopGrainsize,
-                  Reference);
+                  Reference, parameters);
+    }
+
+    Benchmark(bench_name, "FOR", ReductionFor, Reference, parameters);
+    Benchmark(bench_name, "TASKLOOP", ReductionTaskloop, Reference, parameters);
+    Benchmark(bench_name, "TASK", ReductionTask, Reference, parameters);
+    Benchmark(bench_name, "TASKGROUP", ReductionTaskgroup, Reference, parameters);
+
+    // hand-written comparators of the FOR and TASKGROUP reductions
+    Benchmark(bench_name, "FOR_ATOMIC", ReductionForAtomic, Reference, parameters);
+    Benchmark(bench_name, "FOR_CRITICAL", ReductionForCritical, Reference, parameters);
+    Benchmark(bench_name, "FOR_PADDED_PARTIALS", ReductionForPaddedPartials, Reference, parameters);
+    Benchmark(bench_name, "FOR_TREE", ReductionForTree, Reference, parameters);
+    Benchmark(bench_name, "FOR_TREE_NUMA", ReductionForTreeNuma, Reference, parameters);
+    Benchmark(bench_name, "TASKGROUP_ATOMIC", ReductionTaskgroupAtomic, Reference, parameters);
+    Benchmark(bench_name, "TASKGROUP_CRITICAL", ReductionTaskgroupCritical, Reference, parameters);
+    Benchmark(bench_name, "TASKGROUP_PADDED_PARTIALS", ReductionTaskgroupPaddedPartials, Reference, parameters);
+    Benchmark(bench_name, "TASKGROUP_TREE", ReductionTaskgroupTree, Reference, parameters);
+    Benchmark(bench_name, "TASKGROUP_TREE_NUMA", ReductionTaskgroupTreeNuma, Reference, parameters);
+
+    // the same tests with the generated kernels for all valid combinations of operator and type,
+    // OPERATOR_FOR etc. for + on float is comparable to the other cells, FOR etc. above keeps the old loop body
+    RunReductionMatrix<SumKernels, int>(SUM, INT32);
+    RunReductionMatrix<SumKernels, long long>(SUM, INT64);
+    RunReductionMatrix<SumKernels, float>(SUM, FLOAT);
+    RunReductionMatrix<SumKernels, double>(SUM, DOUBLE);
+    RunReductionMatrix<SumKernels, std::complex<double>>(SUM, COMPLEX);
+
+    RunReductionMatrix<ProductKernels, int>(PRODUCT, INT32);
+    RunReductionMatrix<ProductKernels, long long>(PRODUCT, INT64);
+    RunReductionMatrix<ProductKernels, float>(PRODUCT, FLOAT);
+    RunReductionMatrix<ProductKernels, double>(PRODUCT, DOUBLE);
+    RunReductionMatrix<ProductKernels, std::complex<double>>(PRODUCT, COMPLEX);
+
+    RunReductionMatrix<MinKernels, int>(MIN, INT32);
+    RunReductionMatrix<MinKernels, long long>(MIN, INT64);
+    RunReductionMatrix<MinKernels, float>(MIN, FLOAT);
+    RunReductionMatrix<MinKernels, double>(MIN, DOUBLE);
+
+    RunReductionMatrix<MaxKernels, int>(MAX, INT32);
+    RunReductionMatrix<MaxKernels, long long>(MAX, INT64);
+    RunReductionMatrix<MaxKernels, float>(MAX, FLOAT);
+    RunReductionMatrix<MaxKernels, double>(MAX, DOUBLE);
+
+    // the bitwise operators are only defined for integers
+    RunReductionMatrix<BitAndKernels, int>(BIT_AND, INT32);
+    RunReductionMatrix<BitAndKernels, long long>(BIT_AND, INT64);
+    RunReductionMatrix<BitOrKernels, int>(BIT_OR, INT32);
+    RunReductionMatrix<BitOrKernels, long long>(BIT_OR, INT64);
+    RunReductionMatrix<BitXorKernels, int>(BIT_XOR, INT32);
+    RunReductionMatrix<BitXorKernels, long long>(BIT_XOR, INT64);
+
+    // GCC 12 crashes (internal compiler error) on task reductions with && and || on floating point types
+    RunReductionMatrix<LogicalAndKernels, int>(LOGICAL_AND, INT32);
+    RunReductionMatrix<LogicalAndKernels, long long>(LOGICAL_AND, INT64);
+    RunReductionMatrixFor<LogicalAndKernels, float>(LOGICAL_AND, FLOAT);
+    RunReductionMatrixFor<LogicalAndKernels, double>(LOGICAL_AND, DOUBLE);
+
+    RunReductionMatrix<LogicalOrKernels, int>(LOGICAL_OR, INT32);
+    RunReductionMatrix<LogicalOrKernels, long long>(LOGICAL_OR, INT64);
+    RunReductionMatrixFor<LogicalOrKernels, float>(LOGICAL_OR, FLOAT);
+    RunReductionMatrixFor<LogicalOrKernels, double>(LOGICAL_OR, DOUBLE);
+}
+
+void PrintParameterLegend() {
+    std::cout << "Parameter Operator: ";
+    for (size_t i = 0; i < OPERATOR_NAMES.size(); i++) {
+        std::cout << i << " = " << OPERATOR_NAMES[i] << (i + 1 < OPERATOR_NAMES.size() ? ", " : "\n");
     }
+    std::cout << "Parameter Type: ";
+    for (size_t i = 0; i < TYPE_NAMES.size(); i++) {
+        std::cout << i << " = " << TYPE_NAMES[i] << (i + 1 < TYPE_NAMES.size() ? ", " : "\n");
+    }
+}
 
-    Benchmark(bench_name, "FOR", ReductionFor, Reference);
-    Benchmark(bench_name, "TASKLOOP", ReductionTaskloop, Reference);
-    Benchmark(bench_name, "TASK", ReductionTask, Reference);
-    Benchmark(bench_name, "TASKGROUP", ReductionTaskgroup, Reference);
+template<template<typename> class KERNELS, typename T>
+void RunReductionMatrix(ReductionOperator reduction_operator, ReductionType type) {
+    std::vector<Parameter> parameters = ReductionParameters(reduction_operator, type);
+    Benchmark(bench_name, "OPERATOR_FOR", KERNELS<T>::For, KERNELS<T>::Reference, parameters);
+    Benchmark(bench_name, "OPERATOR_TASKLOOP", KERNELS<T>::Taskloop, KERNELS<T>::Reference, parameters);
+    Benchmark(bench_name, "OPERATOR_TASK", KERNELS<T>::Task, KERNELS<T>::Reference, parameters);
+    Benchmark(bench_name, "OPERATOR_TASKGROUP", KERNELS<T>::Taskgroup, KERNELS<T>::Reference, parameters);
+}
 
+template<template<typename> class KERNELS, typename T>
+void RunReductionMatrixFor(ReductionOperator reduction_operator, ReductionType type) {
+    Benchmark(bench_name, "OPERATOR_FOR", KERNELS<T>::For, KERNELS<T>::Reference, ReductionParameters(reduction_operator, type));
 }
 
-// allocate variables right away to reduce measured work
-unsigned int threads;
-unsigned long long int iterations;
-unsigned long workload;
-unsigned long directive;
 
 void ReductionFor(const DataPoint& data) {
     threads = data.threads;
@@ -175,6 +447,386 @@ void ReductionTaskloopGrainsize(const DataPoint& data) {
     }
 }
 
+void ReductionForAtomic(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float var = 0;
+        #pragma omp parallel for shared(iterations, workload, var) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            #pragma omp atomic
+            var += DELAY_A;
+        }
+    }
+}
+
+void ReductionForCritical(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float var = 0;
+        #pragma omp parallel for shared(iterations, workload, var) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i)
+            #pragma omp critical
+            var = var + DELAY_A;
+        }
+    }
+}
+
+void ReductionForPaddedPartials(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    PaddedPartial *partials = padded_partials;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float var = 0;
+        #pragma omp parallel shared(iterations, workload, var, partials) default(none) num_threads(threads)
+        {
+            PaddedPartial *own = &partials[omp_get_thread_num()];
+            own->value = 0;
+
+            #pragma omp for
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                own->value = own->value + DELAY_A;
+            }
+
+            #pragma omp master
+            {
+                for (int thread = 0; thread < omp_get_num_threads(); thread++) {
+                    var = var + partials[thread].value;
+                }
+            }
+        }
+    }
+}
+
+void ReductionForTree(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    PaddedPartial *partials = padded_partials;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float var = 0;
+        #pragma omp parallel shared(iterations, workload, var, partials) default(none) num_threads(threads)
+        {
+            int thread = omp_get_thread_num();
+            int num_threads = omp_get_num_threads();
+            partials[thread].value = 0;
+
+            // the first step of the tree starts with a barrier
+            #pragma omp for nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                partials[thread].value = partials[thread].value + DELAY_A;
+            }
+
+            // in every step the threads with an index divisible by 2 * distance add the partial of index + distance
+            for (int distance = 1; distance < num_threads; distance = distance * 2) {
+                #pragma omp barrier
+                if (thread % (2 * distance) == 0 && thread + distance < num_threads) {
+                    partials[thread].value = partials[thread].value + partials[thread + distance].value;
+                }
+            }
+
+            #pragma omp master
+            var = var + partials[0].value;
+        }
+    }
+}
+
+PlaceLayout ComputePlaceLayout(unsigned int team_size) {
+    // -1 without places, then all threads are in the same place
+    std::vector<int> places(team_size, -1);
+    #pragma omp parallel shared(places) default(none) num_threads(team_size)
+    places[omp_get_thread_num()] = omp_get_place_num();
+
+    PlaceLayout layout;
+    layout.place_members.resize(team_size);
+    std::iota(layout.place_members.begin(), layout.place_members.end(), 0);
+    // stable, so the first thread of every place has the lowest thread number of the place
+    std::stable_sort(layout.place_members.begin(), layout.place_members.end(),
+                     [&places](int a, int b) { return places[a] < places[b]; });
+
+    layout.place_first.resize(team_size);
+    layout.place_size.resize(team_size);
+    layout.place_rank.resize(team_size);
+    layout.leader_index.assign(team_size, -1);
+    int first = 0;
+    for (int index = 0; index < (int) team_size; index++) {
+        int thread = layout.place_members[index];
+        if (index == 0 || places[layout.place_members[index - 1]] != places[thread]) {
+            first = index;
+            layout.leader_index[thread] = (int) layout.leaders.size();
+            layout.leaders.push_back(thread);
+        }
+        layout.place_first[thread] = first;
+        layout.place_rank[thread] = index - first;
+    }
+    for (size_t leader = 0; leader < layout.leaders.size(); leader++) {
+        int begin = layout.place_first[layout.leaders[leader]];
+        int end = leader + 1 < layout.leaders.size() ? layout.place_first[layout.leaders[leader + 1]] : (int) team_size;
+        for (int index = begin; index < end; index++) {
+            layout.place_size[layout.place_members[index]] = end - begin;
+        }
+        layout.max_place_size = std::max(layout.max_place_size, end - begin);
+    }
+    return layout;
+}
+
+void ReductionForTreeNuma(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    PaddedPartial *partials = padded_partials;
+    const PlaceLayout *layout = &place_layouts.at(threads);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float var = 0;
+        #pragma omp parallel shared(iterations, workload, var, partials, layout) default(none) num_threads(threads)
+        {
+            int thread = omp_get_thread_num();
+            int first = layout->place_first[thread];
+            int size = layout->place_size[thread];
+            int rank = layout->place_rank[thread];
+            int leader_index = layout->leader_index[thread];
+            int num_leaders = (int) layout->leaders.size();
+            partials[thread].value = 0;
+
+            // the first step of the tree starts with a barrier
+            #pragma omp for nowait
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i)
+                partials[thread].value = partials[thread].value + DELAY_A;
+            }
+
+            // the same tree as in ReductionForTree over the ranks of the threads in their place,
+            // the partials of a place end up in the partial of its leader
+            for (int distance = 1; distance < layout->max_place_size; distance = distance * 2) {
+                #pragma omp barrier
+                if (rank % (2 * distance) == 0 && rank + distance < size) {
+                    int other = layout->place_members[first + rank + distance];
+                    partials[thread].value = partials[thread].value + partials[other].value;
+                }
+            }
+
+            // then the tree over the leaders, only one value per place crosses the places in every step
+            for (int distance = 1; distance < num_leaders; distance = distance * 2) {
+                #pragma omp barrier
+                if (leader_index >= 0 && leader_index % (2 * distance) == 0 && leader_index + distance < num_leaders) {
+                    int other = layout->leaders[leader_index + distance];
+                    partials[thread].value = partials[thread].value + partials[other].value;
+                }
+            }
+
+            // the first leader did the last step itself
+            if (leader_index == 0) {
+                var = var + partials[thread].value;
+            }
+        }
+    }
+}
+
+void ReductionTaskgroupAtomic(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    directive = data.directive;
+
+    #pragma omp parallel shared(iterations, workload, directive) default(none) num_threads(threads)
+    {
+        #pragma omp master
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                float var = 0.0;
+                #pragma omp taskgroup
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task default(none) firstprivate(i) shared(workload, var)
+                    {
+                        DELAY(workload, i)
+                        #pragma omp atomic
+                        var += DELAY_A;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void ReductionTaskgroupCritical(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    directive = data.directive;
+
+    #pragma omp parallel shared(iterations, workload, directive) default(none) num_threads(threads)
+    {
+        #pragma omp master
+        {
+            for (int rep = 0; rep < directive; rep++) {
+                float var = 0.0;
+                #pragma omp taskgroup
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task default(none) firstprivate(i) shared(workload, var)
+                    {
+                        DELAY(workload, i)
+                        #pragma omp critical
+                        var = var + DELAY_A;
+                    }
+                }
+            }
+        }
+    }
+}
+
+// The tasks of the taskgroup comparators add to the partial of the executing thread,
+// the task body has no task scheduling point, so no other task of the thread can interleave
+
+void ReductionTaskgroupPaddedPartials(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    directive = data.directive;
+    PaddedPartial *partials = padded_partials;
+
+    #pragma omp parallel shared(iterations, workload, directive, partials) default(none) num_threads(threads)
+    {
+        #pragma omp master
+        {
+            int num_threads = omp_get_num_threads();
+            for (int rep = 0; rep < directive; rep++) {
+                float var = 0.0;
+                for (int thread = 0; thread < num_threads; thread++) {
+                    partials[thread].value = 0;
+                }
+
+                #pragma omp taskgroup
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task default(none) firstprivate(i) shared(workload, partials)
+                    {
+                        DELAY(workload, i)
+                        PaddedPartial *own = &partials[omp_get_thread_num()];
+                        own->value = own->value + DELAY_A;
+                    }
+                }
+
+                for (int thread = 0; thread < num_threads; thread++) {
+                    var = var + partials[thread].value;
+                }
+            }
+        }
+    }
+}
+
+void ReductionTaskgroupTree(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    directive = data.directive;
+    PaddedPartial *partials = padded_partials;
+
+    #pragma omp parallel shared(iterations, workload, directive, partials) default(none) num_threads(threads)
+    {
+        #pragma omp master
+        {
+            int num_threads = omp_get_num_threads();
+            for (int rep = 0; rep < directive; rep++) {
+                float var = 0.0;
+                for (int thread = 0; thread < num_threads; thread++) {
+                    partials[thread].value = 0;
+                }
+
+                #pragma omp taskgroup
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task default(none) firstprivate(i) shared(workload, partials)
+                    {
+                        DELAY(workload, i)
+                        PaddedPartial *own = &partials[omp_get_thread_num()];
+                        own->value = own->value + DELAY_A;
+                    }
+                }
+
+                // one task per pair and level of the tree
+                for (int distance = 1; distance < num_threads; distance = distance * 2) {
+                    for (int thread = 0; thread + distance < num_threads; thread += 2 * distance) {
+                        #pragma omp task default(none) firstprivate(thread, distance) shared(partials)
+                        partials[thread].value = partials[thread].value + partials[thread + distance].value;
+                    }
+                    #pragma omp taskwait
+                }
+                var = var + partials[0].value;
+            }
+        }
+    }
+}
+
+void ReductionTaskgroupTreeNuma(const DataPoint& data) {
+    threads = data.threads;
+    iterations = data.iterations;
+    workload = data.workload;
+    directive = data.directive;
+    PaddedPartial *partials = padded_partials;
+    const PlaceLayout *layout = &place_layouts.at(threads);
+
+    #pragma omp parallel shared(iterations, workload, directive, partials, layout) default(none) num_threads(threads)
+    {
+        #pragma omp master
+        {
+            int num_threads = omp_get_num_threads();
+            int num_leaders = (int) layout->leaders.size();
+            for (int rep = 0; rep < directive; rep++) {
+                float var = 0.0;
+                for (int thread = 0; thread < num_threads; thread++) {
+                    partials[thread].value = 0;
+                }
+
+                #pragma omp taskgroup
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task default(none) firstprivate(i) shared(workload, partials)
+                    {
+                        DELAY(workload, i)
+                        PaddedPartial *own = &partials[omp_get_thread_num()];
+                        own->value = own->value + DELAY_A;
+                    }
+                }
+
+                // one task per pair and level of the tree over the ranks in every place, with an affinity to the place
+                for (int distance = 1; distance < layout->max_place_size; distance = distance * 2) {
+                    for (int thread = 0; thread < num_threads; thread++) {
+                        int rank = layout->place_rank[thread];
+                        if (rank % (2 * distance) == 0 && rank + distance < layout->place_size[thread]) {
+                            int other = layout->place_members[layout->place_first[thread] + rank + distance];
+                            #pragma omp task default(none) firstprivate(thread, other) shared(partials) affinity(partials[thread])
+                            partials[thread].value = partials[thread].value + partials[other].value;
+                        }
+                    }
+                    #pragma omp taskwait
+                }
+
+                // then one task per pair and level of the tree over the leaders of the places
+                for (int distance = 1; distance < num_leaders; distance = distance * 2) {
+                    for (int index = 0; index + distance < num_leaders; index += 2 * distance) {
+                        int thread = layout->leaders[index];
+                        int other = layout->leaders[index + distance];
+                        #pragma omp task default(none) firstprivate(thread, other) shared(partials) affinity(partials[thread])
+                        partials[thread].value = partials[thread].value + partials[other].value;
+                    }
+                    #pragma omp taskwait
+                }
+                var = var + partials[layout->leaders[0]].value;
+            }
+        }
+    }
+}
+
 void Reference(const DataPoint& data) {
     threads = data.threads; // not used, only here for equal amount of work in Test and Reference
     iterations = data.iterations;
@@ -27,6 +27,50 @@ void ReductionTask(const DataPoint& data);
 /// @param data the configuration for the microbenchmark
 void ReductionTaskgroup(const DataPoint& data);
 
+/// @brief Comparator for ReductionFor, every iteration adds to the shared variable with an atomic update
+/// @param data the configuration for the microbenchmark
+void ReductionForAtomic(const DataPoint& data);
+
+/// @brief Comparator for ReductionFor, every iteration adds to the shared variable in a critical region
+/// @param data the configuration for the microbenchmark
+void ReductionForCritical(const DataPoint& data);
+
+/// @brief Comparator for ReductionFor, every thread adds to its own partial padded to a cache line,
+/// the master thread combines the partials serially
+/// @param data the configuration for the microbenchmark
+void ReductionForPaddedPartials(const DataPoint& data);
+
+/// @brief Comparator for ReductionFor, padded per-thread partials combined in a log-depth tree
+/// @param data the configuration for the microbenchmark
+void ReductionForTree(const DataPoint& data);
+
+/// @brief Comparator for ReductionFor, padded per-thread partials combined in a log-depth tree inside every place,
+/// then in a log-depth tree over the first threads of the places (NUMA-aware with OMP_PLACES=numa_domains)
+/// @param data the configuration for the microbenchmark
+void ReductionForTreeNuma(const DataPoint& data);
+
+/// @brief Comparator for ReductionTaskgroup, every task adds to the shared variable with an atomic update
+/// @param data the configuration for the microbenchmark
+void ReductionTaskgroupAtomic(const DataPoint& data);
+
+/// @brief Comparator for ReductionTaskgroup, every task adds to the shared variable in a critical region
+/// @param data the configuration for the microbenchmark
+void ReductionTaskgroupCritical(const DataPoint& data);
+
+/// @brief Comparator for ReductionTaskgroup, every task adds to the padded partial of the executing thread,
+/// the master thread combines the partials serially after the taskgroup
+/// @param data the configuration for the microbenchmark
+void ReductionTaskgroupPaddedPartials(const DataPoint& data);
+
+/// @brief Comparator for ReductionTaskgroup, the padded partials of the threads are combined by tasks in a log-depth tree
+/// @param data the configuration for the microbenchmark
+void ReductionTaskgroupTree(const DataPoint& data);
+
+/// @brief Comparator for ReductionTaskgroup, the padded partials of the threads of every place are combined by tasks
+/// in a log-depth tree with an affinity to the place, then by tasks in a log-depth tree over the places
+/// @param data the configuration for the microbenchmark
+void ReductionTaskgroupTreeNuma(const DataPoint& data);
+
 /// @brief Reference implementation of a variable aggregation, for overhead calculation
 /// @param data the configuration for the reference
 void Reference(const DataPoint& data);
@@ -0,0 +1,169 @@
+#include <omp.h>
+#include <algorithm>
+#include "scan_bench.h"
+#include "commons.h"
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+/// @brief Runs all tests for the element type T
+/// @param type_name the suffix of the test names
+template<typename T>
+void RunBenchmarksForType(const std::string &type_name);
+
+std::string bench_name = "SCAN";
+
+/// @brief The input and output arrays for the element type T, allocated for the maximum number of iterations
+template<typename T>
+struct ScanArrays {
+    static std::vector<T> input;
+    static std::vector<T> output;
+    /// the sums of the blocks of the blocked scan, one more than the maximum number of threads
+    static std::vector<T> block_sums;
+};
+
+template<typename T> std::vector<T> ScanArrays<T>::input;
+template<typename T> std::vector<T> ScanArrays<T>::output;
+template<typename T> std::vector<T> ScanArrays<T>::block_sums;
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    RunBenchmarksForType<int>("INT");
+    RunBenchmarksForType<float>("FLOAT");
+    RunBenchmarksForType<double>("DOUBLE");
+}
+
+template<typename T>
+void RunBenchmarksForType(const std::string &type_name) {
+    unsigned long long max_iterations = *std::max_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end());
+    unsigned int max_threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+
+    // all elements are 1, so that the int sums don't overflow
+    ScanArrays<T>::input.assign(max_iterations, 1);
+    ScanArrays<T>::output.assign(max_iterations, 0);
+    ScanArrays<T>::block_sums.assign(max_threads + 1, 0);
+
+    Benchmark(bench_name, "INCLUSIVE_" + type_name, TestScanInclusive<T>, Reference<T>);
+    Benchmark(bench_name, "EXCLUSIVE_" + type_name, TestScanExclusive<T>, Reference<T>);
+    Benchmark(bench_name, "BLOCKED_" + type_name, TestScanBlocked<T>, Reference<T>);
+
+    // free the memory before the next type
+    std::vector<T>().swap(ScanArrays<T>::input);
+    std::vector<T>().swap(ScanArrays<T>::output);
+}
+
+template<typename T>
+void TestScanInclusive(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    T *input = ScanArrays<T>::input.data();
+    T *output = ScanArrays<T>::output.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        T sum = 0;
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, input, output) reduction(inscan, + : sum)
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+            sum += input[i];
+            #pragma omp scan inclusive(sum)
+            output[i] = sum;
+        }
+    }
+}
+
+template<typename T>
+void TestScanExclusive(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    T *input = ScanArrays<T>::input.data();
+    T *output = ScanArrays<T>::output.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        T sum = 0;
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, input, output) reduction(inscan, + : sum)
+        for (int i = 0; i < iterations; i++) {
+            output[i] = sum;
+            #pragma omp scan exclusive(sum)
+            DELAY(workload, i);
+            sum += input[i];
+        }
+    }
+}
+
+template<typename T>
+void TestScanBlocked(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    T *input = ScanArrays<T>::input.data();
+    T *output = ScanArrays<T>::output.data();
+    T *block_sums = ScanArrays<T>::block_sums.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, input, output, block_sums)
+        {
+            int thread = omp_get_thread_num();
+            int num_threads = omp_get_num_threads();
+            unsigned long long begin = iterations * thread / num_threads;
+            unsigned long long end = iterations * (thread + 1) / num_threads;
+
+            // first pass: scan of the own block, the workload is only done here
+            T sum = 0;
+            for (unsigned long long i = begin; i < end; i++) {
+                DELAY(workload, i);
+                sum += input[i];
+                output[i] = sum;
+            }
+            block_sums[thread + 1] = sum;
+
+            #pragma omp barrier
+            #pragma omp single
+            {
+                block_sums[0] = 0;
+                for (int block = 1; block <= num_threads; block++) {
+                    block_sums[block] += block_sums[block - 1];
+                }
+            }
+
+            // second pass: add the sum of all preceding blocks
+            T offset = block_sums[thread];
+            for (unsigned long long i = begin; i < end; i++) {
+                output[i] += offset;
+            }
+        }
+    }
+}
+
+template<typename T>
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    T *input = ScanArrays<T>::input.data();
+    T *output = ScanArrays<T>::output.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        T sum = 0;
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+            sum += input[i];
+            output[i] = sum;
+        }
+    }
+}
@@ -0,0 +1,27 @@
+#ifndef PPT_P4_SCAN_H
+#define PPT_P4_SCAN_H
+
+#include "commons.h"
+
+/// @brief Inclusive prefix sum over an array with one element per iteration, with reduction(inscan) and scan inclusive
+/// @param data the configuration for the microbenchmark
+template<typename T>
+void TestScanInclusive(const DataPoint& data);
+
+/// @brief Exclusive prefix sum over an array with one element per iteration, with reduction(inscan) and scan exclusive
+/// @param data the configuration for the microbenchmark
+template<typename T>
+void TestScanExclusive(const DataPoint& data);
+
+/// @brief Hand-written inclusive prefix sum with two passes: every thread scans its block, the sums of the blocks
+/// are scanned by one thread, then every thread adds the sum of the preceding blocks to its block
+/// @param data the configuration for the microbenchmark
+template<typename T>
+void TestScanBlocked(const DataPoint& data);
+
+/// @brief Reference implementation, serial inclusive prefix sum
+/// @param data the configuration for the reference
+template<typename T>
+void Reference(const DataPoint& data);
+
+#endif //PPT_P4_SCAN_H
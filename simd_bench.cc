@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <cstdlib>
+#include "simd_bench.h"
+#include "commons.h"
+
+// The references have to stay scalar, even though this file is built with -O3
+#if defined(__clang__)
+    #define NO_VECTORIZE
+    #define SCALAR_LOOP PRAGMA(clang loop vectorize(disable) interleave(disable))
+    #define NO_INLINE __attribute__((noinline))
+#elif defined(__GNUC__)
+    #define NO_VECTORIZE __attribute__((optimize("no-tree-vectorize")))
+    #define SCALAR_LOOP
+    #define NO_INLINE __attribute__((noinline))
+#else
+    #define NO_VECTORIZE
+    #define SCALAR_LOOP
+    #define NO_INLINE
+#endif
+
+// The workload of one iteration is a recurrence on its element, so that the inner loop can't be vectorized,
+// but the iterations are independent and are computed in the lanes of a vector.
+// The do-while loop has no guard before the first multiply-add, otherwise the outer loop is not vectorized,
+// so at least one multiply-add is done for workload 0.
+#define SIMD_DELAY(WORKLOAD, I, A, B, C) \
+float SIMD_VALUE = C[I]; \
+int DELAY_I = 0; \
+do { \
+    SIMD_VALUE = SIMD_VALUE * A[I] + B[I]; \
+} while (++DELAY_I < WORKLOAD); \
+C[I] = SIMD_VALUE;
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+std::string bench_name = "SIMD";
+
+// The arrays of the workload, one element per iteration, allocated for the maximum number of iterations
+float *array_a;
+float *array_b;
+float *array_c;
+
+// the result of the reductions, stored so that they are not eliminated
+float reduction_result;
+
+#define SIMD_ALIGNMENT 64
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    // aligned_alloc needs a multiple of the alignment
+    unsigned long long max_iterations = *std::max_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end());
+    unsigned long long bytes = (max_iterations * sizeof(float) + SIMD_ALIGNMENT - 1) / SIMD_ALIGNMENT * SIMD_ALIGNMENT;
+    array_a = (float *) aligned_alloc(SIMD_ALIGNMENT, bytes);
+    array_b = (float *) aligned_alloc(SIMD_ALIGNMENT, bytes);
+    array_c = (float *) aligned_alloc(SIMD_ALIGNMENT, bytes);
+
+    // the recurrence converges to 2, so there are no denormals or infinities
+    for (unsigned long long i = 0; i < max_iterations; i++) {
+        array_a[i] = 0.5f;
+        array_b[i] = 1.0f;
+        array_c[i] = 0.0f;
+    }
+
+    RunBenchmarks();
+
+    free(array_a);
+    free(array_b);
+    free(array_c);
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    // SIMD and SIMD_REDUCTION don't create a team, so the whole reference is subtracted at every number of threads
+    Benchmark(bench_name, "SIMD", TestSimd, Reference, {}, 1.0);
+    Benchmark(bench_name, "PARALLEL_FOR", TestSimdParallelFor, Reference);
+    Benchmark(bench_name, "PARALLEL_FOR_SIMD", TestSimdParallelForSimd, Reference);
+    Benchmark(bench_name, "DECLARE_SIMD", TestSimdDeclareSimd, Reference);
+    Benchmark(bench_name, "SIMD_REDUCTION", TestSimdReduction, ReferenceReduction, {}, 1.0);
+    Benchmark(bench_name, "PARALLEL_FOR_SIMD_REDUCTION", TestSimdParallelForSimdReduction, ReferenceReduction);
+    Benchmark(bench_name, "SIMDLEN_4", TestSimdSimdlen<4>, Reference);
+    Benchmark(bench_name, "SIMDLEN_8", TestSimdSimdlen<8>, Reference);
+    Benchmark(bench_name, "SIMDLEN_16", TestSimdSimdlen<16>, Reference);
+    Benchmark(bench_name, "SAFELEN_2", TestSimdSafelen<2>, Reference);
+    Benchmark(bench_name, "SAFELEN_8", TestSimdSafelen<8>, Reference);
+    Benchmark(bench_name, "ALIGNED", TestSimdAligned, Reference);
+    Benchmark(bench_name, "LINEAR", TestSimdLinear, Reference);
+    Benchmark(bench_name, "TASKLOOP_SIMD", TestSimdTaskloopSimd, Reference);
+}
+
+/// @brief The workload of one iteration as a function, the vector variant gets one element per lane
+#pragma omp declare simd uniform(workload) notinbranch
+NO_INLINE float SimdDelayFunction(float value, float a, float b, unsigned long workload) {
+    int delay_i = 0;
+    do {
+        value = value * a + b;
+    } while (++delay_i < workload);
+    return value;
+}
+
+void TestSimd(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, the simd construct is executed by one thread
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp simd
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+void TestSimdParallelFor(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+void TestSimdParallelForSimd(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for simd num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+void TestSimdDeclareSimd(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for simd num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        for (int i = 0; i < iterations; i++) {
+            c[i] = SimdDelayFunction(c[i], a[i], b[i], workload);
+        }
+    }
+}
+
+void TestSimdReduction(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, the simd construct is executed by one thread
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float sum = 0;
+        #pragma omp simd reduction(+ : sum)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+            sum += SIMD_VALUE;
+        }
+        reduction_result = sum;
+    }
+}
+
+void TestSimdParallelForSimdReduction(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float sum = 0;
+        #pragma omp parallel for simd num_threads(threads) default(none) shared(iterations, workload, a, b, c) reduction(+ : sum)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+            sum += SIMD_VALUE;
+        }
+        reduction_result = sum;
+    }
+}
+
+template<int SIMDLEN>
+void TestSimdSimdlen(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for simd simdlen(SIMDLEN) num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+template<int SAFELEN>
+void TestSimdSafelen(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for simd safelen(SAFELEN) num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+void TestSimdAligned(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for simd aligned(a, b, c : SIMD_ALIGNMENT) num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+void TestSimdLinear(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float *a = array_a, *b = array_b, *c = array_c;
+        #pragma omp parallel for simd linear(a, b, c : 1) num_threads(threads) default(none) shared(iterations, workload)
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, 0, a, b, c);
+            a++;
+            b++;
+            c++;
+        }
+    }
+}
+
+void TestSimdTaskloopSimd(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload, a, b, c)
+        {
+            #pragma omp master
+            {
+                #pragma omp taskloop simd default(none) shared(iterations, workload, a, b, c)
+                for (int i = 0; i < iterations; i++) {
+                    SIMD_DELAY(workload, i, a, b, c);
+                }
+            }
+        }
+    }
+}
+
+NO_VECTORIZE void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        SCALAR_LOOP
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+        }
+    }
+}
+
+NO_VECTORIZE void ReferenceReduction(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    float *a = array_a, *b = array_b, *c = array_c;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float sum = 0;
+        SCALAR_LOOP
+        for (int i = 0; i < iterations; i++) {
+            SIMD_DELAY(workload, i, a, b, c);
+            sum += SIMD_VALUE;
+        }
+        reduction_result = sum;
+    }
+}
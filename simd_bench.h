@@ -0,0 +1,60 @@
+#ifndef PPT_P4_SIMD_H
+#define PPT_P4_SIMD_H
+
+#include "commons.h"
+
+/// @brief Serial loop with the simd construct, the iterations are computed in the lanes of a vector
+/// @param data the configuration for the microbenchmark
+void TestSimd(const DataPoint& data);
+
+/// @brief Worksharing loop without the simd construct, only thread-level parallelism
+/// @param data the configuration for the microbenchmark
+void TestSimdParallelFor(const DataPoint& data);
+
+/// @brief Worksharing loop with the simd construct (parallel for simd), thread- and vector-level parallelism
+/// @param data the configuration for the microbenchmark
+void TestSimdParallelForSimd(const DataPoint& data);
+
+/// @brief parallel for simd, the workload is a function with declare simd, called through its vector variant
+/// @param data the configuration for the microbenchmark
+void TestSimdDeclareSimd(const DataPoint& data);
+
+/// @brief Serial loop with the simd construct and a reduction over all elements
+/// @param data the configuration for the microbenchmark
+void TestSimdReduction(const DataPoint& data);
+
+/// @brief parallel for simd with a reduction over all elements
+/// @param data the configuration for the microbenchmark
+void TestSimdParallelForSimdReduction(const DataPoint& data);
+
+/// @brief parallel for simd with the preferred number of lanes given by simdlen(SIMDLEN)
+/// @param data the configuration for the microbenchmark
+template<int SIMDLEN>
+void TestSimdSimdlen(const DataPoint& data);
+
+/// @brief parallel for simd with at most SAFELEN iterations executed concurrently, given by safelen(SAFELEN)
+/// @param data the configuration for the microbenchmark
+template<int SAFELEN>
+void TestSimdSafelen(const DataPoint& data);
+
+/// @brief parallel for simd with the aligned clause for all arrays
+/// @param data the configuration for the microbenchmark
+void TestSimdAligned(const DataPoint& data);
+
+/// @brief parallel for simd, the arrays are accessed through pointers incremented in every iteration and declared linear
+/// @param data the configuration for the microbenchmark
+void TestSimdLinear(const DataPoint& data);
+
+/// @brief Tasks created by the master thread with taskloop simd
+/// @param data the configuration for the microbenchmark
+void TestSimdTaskloopSimd(const DataPoint& data);
+
+/// @brief Reference implementation, serial loop which is not vectorized
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+/// @brief Reference implementation with a reduction, serial loop which is not vectorized
+/// @param data the configuration for the reference
+void ReferenceReduction(const DataPoint& data);
+
+#endif //PPT_P4_SIMD_H
@@ -0,0 +1,276 @@
+#ifndef PPT_P4_SYNC_BARRIERS_H
+#define PPT_P4_SYNC_BARRIERS_H
+
+#include <omp.h>
+#include <algorithm>
+#include <atomic>
+#include <vector>
+#include "sync_locks.h"
+
+// User-space barrier implementations for sync_bench. All barriers have the same interface:
+// the barrier is created outside of the parallel region for a fixed number of threads,
+// every thread calls Wait with its thread number. All barriers use sense reversal, so they can be reused right away.
+
+/// @brief A flag on its own cache line
+struct PaddedFlag {
+    std::atomic<bool> value{false};
+    char padding[CACHE_LINE_SIZE];
+};
+
+/// @brief A counter with the sense of its current episode on its own cache line
+struct PaddedCounter {
+    std::atomic<unsigned int> count{0};
+    std::atomic<bool> sense{false};
+    unsigned int size = 0;
+    char padding[CACHE_LINE_SIZE];
+};
+
+/// @brief Centralized sense-reversal barrier: one shared counter, the last thread flips the shared sense
+class CentralBarrier {
+public:
+    explicit CentralBarrier(unsigned int threads) : local_senses(threads) {
+        counter.size = threads;
+        counter.count.store(threads, std::memory_order_relaxed);
+    }
+
+    void Wait(unsigned int thread) {
+        bool sense = !local_senses[thread].value.load(std::memory_order_relaxed);
+        local_senses[thread].value.store(sense, std::memory_order_relaxed);
+
+        if (counter.count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            counter.count.store(counter.size, std::memory_order_relaxed);
+            counter.sense.store(sense, std::memory_order_release);
+        } else {
+            while (counter.sense.load(std::memory_order_acquire) != sense) {
+                CPU_RELAX();
+            }
+        }
+    }
+
+private:
+    PaddedCounter counter;
+    std::vector<PaddedFlag> local_senses;
+};
+
+/// @brief Combining tree barrier: the threads arrive at the leaves of a tree with fan-in FAN_IN,
+/// the last thread arriving at a node continues to its parent, the last thread at the root releases all threads
+class CombiningTreeBarrier {
+public:
+    explicit CombiningTreeBarrier(unsigned int threads) : local_senses(threads) {
+        // the levels of the tree from the leaves to the root, nodes[level][i] has the children FAN_IN * i ... of level - 1
+        unsigned int width = threads;
+        do {
+            unsigned int parents = (width + FAN_IN - 1) / FAN_IN;
+            std::vector<PaddedCounter> level(parents);
+            for (unsigned int i = 0; i < parents; i++) {
+                level[i].size = width - i * FAN_IN < FAN_IN ? width - i * FAN_IN : FAN_IN;
+                level[i].count.store(level[i].size, std::memory_order_relaxed);
+            }
+            nodes.push_back(std::move(level));
+            width = parents;
+        } while (width > 1);
+    }
+
+    void Wait(unsigned int thread) {
+        bool sense = !local_senses[thread].value.load(std::memory_order_relaxed);
+        local_senses[thread].value.store(sense, std::memory_order_relaxed);
+        Arrive(0, thread / FAN_IN, sense);
+    }
+
+private:
+    static const unsigned int FAN_IN = 4;
+
+    void Arrive(unsigned int level, unsigned int index, bool sense) {
+        PaddedCounter &node = nodes[level][index];
+        if (node.count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            if (level + 1 < nodes.size()) {
+                Arrive(level + 1, index / FAN_IN, sense);
+            }
+            node.count.store(node.size, std::memory_order_relaxed);
+            node.sense.store(sense, std::memory_order_release);
+        } else {
+            while (node.sense.load(std::memory_order_acquire) != sense) {
+                CPU_RELAX();
+            }
+        }
+    }
+
+    std::vector<std::vector<PaddedCounter>> nodes;
+    std::vector<PaddedFlag> local_senses;
+};
+
+/// @brief Dissemination barrier: in round r every thread signals the thread 2^r further and waits for the thread 2^r before,
+/// after ceil(log2(threads)) rounds all threads know that all threads arrived. There is no release phase
+class DisseminationBarrier {
+public:
+    explicit DisseminationBarrier(unsigned int threads) : threads(threads), states(threads) {
+        while ((1u << rounds) < threads) {
+            rounds++;
+        }
+    }
+
+    void Wait(unsigned int thread) {
+        ThreadState &state = states[thread];
+        for (unsigned int round = 0; round < rounds; round++) {
+            unsigned int partner = (thread + (1u << round)) % threads;
+            states[partner].flags[state.parity][round].store(state.sense, std::memory_order_release);
+            while (state.flags[state.parity][round].load(std::memory_order_acquire) != state.sense) {
+                CPU_RELAX();
+            }
+        }
+        // two sets of flags, so that a fast thread can't overwrite the flags of the previous episode
+        if (state.parity == 1) {
+            state.sense = !state.sense;
+        }
+        state.parity = 1 - state.parity;
+    }
+
+private:
+    static const unsigned int MAX_ROUNDS = 32;
+
+    struct ThreadState {
+        std::atomic<bool> flags[2][MAX_ROUNDS];
+        int parity = 0;
+        bool sense = true;
+        char padding[CACHE_LINE_SIZE];
+
+        ThreadState() {
+            for (auto &parity_flags : flags) {
+                for (auto &flag : parity_flags) {
+                    flag.store(false, std::memory_order_relaxed);
+                }
+            }
+        }
+    };
+
+    unsigned int threads;
+    unsigned int rounds = 0;
+    std::vector<ThreadState> states;
+};
+
+/// @brief Tournament barrier: in round r the thread with a multiple of 2^(r + 1) as number (the winner) waits for the thread
+/// 2^r further (the loser). The losers wait for the release, thread 0 wins all rounds and releases the losers
+/// in reverse order of the rounds, every released thread releases the threads it won against
+class TournamentBarrier {
+public:
+    explicit TournamentBarrier(unsigned int threads) : threads(threads), states(threads) {}
+
+    void Wait(unsigned int thread) {
+        ThreadState &state = states[thread];
+        bool sense = state.sense;
+
+        unsigned int round = 0;
+        for (; (1u << round) < threads; round++) {
+            if (thread % (1u << (round + 1)) == 0) {
+                // bye, if the loser doesn't exist
+                if (thread + (1u << round) < threads) {
+                    while (state.arrived[round].load(std::memory_order_acquire) != sense) {
+                        CPU_RELAX();
+                    }
+                }
+            } else {
+                states[thread - (1u << round)].arrived[round].store(sense, std::memory_order_release);
+                while (state.released.load(std::memory_order_acquire) != sense) {
+                    CPU_RELAX();
+                }
+                break;
+            }
+        }
+
+        // release the threads this thread won against
+        while (round-- > 0) {
+            if (thread + (1u << round) < threads) {
+                states[thread + (1u << round)].released.store(sense, std::memory_order_release);
+            }
+        }
+        state.sense = !sense;
+    }
+
+private:
+    static const unsigned int MAX_ROUNDS = 32;
+
+    struct ThreadState {
+        std::atomic<bool> arrived[MAX_ROUNDS];
+        std::atomic<bool> released{false};
+        bool sense = true;
+        char padding[CACHE_LINE_SIZE];
+
+        ThreadState() {
+            for (auto &flag : arrived) {
+                flag.store(false, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    unsigned int threads;
+    std::vector<ThreadState> states;
+};
+
+/// @brief Hierarchical barrier: a centralized barrier for the threads of every place, the last thread of every place
+/// continues to a centralized barrier of the places. Without places, every GROUP_SIZE consecutive threads form a group.
+/// The places of the threads are taken from a parallel region in the constructor, so the threads have to stay bound
+class HierarchicalBarrier {
+public:
+    explicit HierarchicalBarrier(unsigned int threads) : group_of_thread(threads), local_senses(threads) {
+        std::vector<int> &places = group_of_thread;
+        #pragma omp parallel num_threads(threads) default(none) shared(places)
+        {
+            int place = omp_get_place_num();
+            places[omp_get_thread_num()] = place >= 0 ? place : omp_get_thread_num() / GROUP_SIZE;
+        }
+
+        // the groups are numbered densely, in the order of the first thread of every group
+        std::vector<int> group_numbers;
+        for (int &group : group_of_thread) {
+            auto position = std::find(group_numbers.begin(), group_numbers.end(), group);
+            if (position == group_numbers.end()) {
+                group_numbers.push_back(group);
+                position = group_numbers.end() - 1;
+            }
+            group = position - group_numbers.begin();
+        }
+
+        groups = std::vector<PaddedCounter>(group_numbers.size());
+        for (int group : group_of_thread) {
+            groups[group].size++;
+        }
+        for (auto &group : groups) {
+            group.count.store(group.size, std::memory_order_relaxed);
+        }
+        top.size = groups.size();
+        top.count.store(top.size, std::memory_order_relaxed);
+    }
+
+    void Wait(unsigned int thread) {
+        bool sense = !local_senses[thread].value.load(std::memory_order_relaxed);
+        local_senses[thread].value.store(sense, std::memory_order_relaxed);
+
+        PaddedCounter &group = groups[group_of_thread[thread]];
+        if (group.count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            if (top.count.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                top.count.store(top.size, std::memory_order_relaxed);
+                top.sense.store(sense, std::memory_order_release);
+            } else {
+                while (top.sense.load(std::memory_order_acquire) != sense) {
+                    CPU_RELAX();
+                }
+            }
+            group.count.store(group.size, std::memory_order_relaxed);
+            group.sense.store(sense, std::memory_order_release);
+        } else {
+            while (group.sense.load(std::memory_order_acquire) != sense) {
+                CPU_RELAX();
+            }
+        }
+    }
+
+private:
+    static const unsigned int GROUP_SIZE = 4;
+
+    std::vector<int> group_of_thread;
+    std::vector<PaddedCounter> groups;
+    PaddedCounter top;
+    std::vector<PaddedFlag> local_senses;
+};
+
+#endif //PPT_P4_SYNC_BARRIERS_H
@@ -1,19 +1,145 @@
 #include <omp.h>
 #include "sync_bench.h"
 #include "commons.h"
+#include "sync_locks.h"
+#include "sync_barriers.h"
 #include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#if defined(__x86_64__) || defined(__i386__)
+    #include <cpuid.h>
+#endif
+
+/// @brief Prints the acquisitions per thread and the handoff latency of all locks.
+/// Every thread acquires the lock until the first number of iterations is reached, so the distribution is not fixed
+/// by the loop schedule. The handoff latency is the time from a release to the next acquisition by another thread.
+void PrintLockFairness();
+
+/// @brief Prints whether the speculative hints can use transactional memory (Intel RTM).
+/// Without it, the runtime falls back to the nonspeculative lock, so both hints should have the same overhead.
+void PrintSpeculationSupport();
 
 std::string bench_name = "SYNC";
 
+omp_sync_hint_t lock_hint = omp_sync_hint_none;
+int nest_depth = 1;
+
+// the percentage of the workload inside of the critical section, lock or ordered region
+unsigned long critical_fraction = 100;
+
+// the dependency objects of the task wavefronts, one per iteration, the last one is never written
+// and used for the dependencies outside of the iteration space
+std::vector<char> wavefront_cells;
+
+/// @brief The state of the fairness measurement, only accessed while holding the lock
+struct FairnessState {
+    unsigned long long acquisitions = 0;
+    int last_owner = -1;
+    double last_release = 0;
+    unsigned long long handoffs = 0;
+    double handoff_time = 0;
+    std::vector<unsigned long long> counts;
+};
+
 void RunBenchmarks() {
     Benchmark(bench_name, "CRITICAL_SECTION", TestCriticalSection, Reference);
     Benchmark(bench_name, "LOCK", TestLock, Reference);
+
+    // the overhead is the time above Amdahl's law with the critical fraction as serial fraction
+    for (unsigned long fraction : {0, 10, 25, 50, 75, 90, 100}) {
+        critical_fraction = fraction;
+        std::string suffix = "_FRACTION_" + std::to_string(fraction);
+        Benchmark(bench_name, "CRITICAL_SECTION" + suffix, TestCriticalFraction, ReferenceFraction, {}, fraction / 100.0);
+        Benchmark(bench_name, "LOCK" + suffix, TestLockFraction, ReferenceFraction, {}, fraction / 100.0);
+        Benchmark(bench_name, "ORDERED" + suffix, TestOrderedFraction, ReferenceFraction, {}, fraction / 100.0);
+    }
+
+    Benchmark(bench_name, "NEST_LOCK", TestNestLock, Reference);
+    Benchmark(bench_name, "LOCK_TAS", TestUserLock<TasLock>, Reference);
+    Benchmark(bench_name, "LOCK_TTAS_BACKOFF", TestUserLock<TtasBackoffLock>, Reference);
+    Benchmark(bench_name, "LOCK_TICKET", TestUserLock<TicketLock>, Reference);
+    Benchmark(bench_name, "LOCK_MCS", TestUserLock<McsLock>, Reference);
+    Benchmark(bench_name, "LOCK_CLH", TestUserLock<ClhLock>, Reference);
+    Benchmark(bench_name, "LOCK_COHORT", TestUserLock<CohortLock>, Reference);
+    PrintLockFairness();
+
+    // the hints are only allowed to change the performance, the runtime may ignore them
+    PrintSpeculationSupport();
+    const std::vector<std::pair<std::string, omp_sync_hint_t>> hints = {
+            {"UNCONTENDED", omp_sync_hint_uncontended},
+            {"CONTENDED", omp_sync_hint_contended},
+            {"SPECULATIVE", omp_sync_hint_speculative},
+            {"NONSPECULATIVE", omp_sync_hint_nonspeculative},
+    };
+    for (const auto &hint : hints) {
+        lock_hint = hint.second;
+#ifdef HAVE_OMP_LOCK_HINT
+        Benchmark(bench_name, "LOCK_HINT_" + hint.first, TestLockHint, Reference);
+#else
+        printf("Skipping LOCK_HINT_%s, omp_init_lock_with_hint is not supported by the runtime\n", hint.first.c_str());
+#endif
+    }
+    Benchmark(bench_name, "CRITICAL_HINT_UNCONTENDED", TestCriticalHintUncontended, Reference);
+    Benchmark(bench_name, "CRITICAL_HINT_CONTENDED", TestCriticalHintContended, Reference);
+    Benchmark(bench_name, "CRITICAL_HINT_SPECULATIVE", TestCriticalHintSpeculative, Reference);
+    Benchmark(bench_name, "CRITICAL_HINT_NONSPECULATIVE", TestCriticalHintNonspeculative, Reference);
+
+    for (nest_depth = 1; nest_depth <= 32; nest_depth *= 2) {
+        Benchmark(bench_name, "NEST_LOCK_DEPTH_" + std::to_string(nest_depth), TestNestLockDepth, Reference);
+    }
+    Benchmark(bench_name, "TEST_LOCK", TestTestLock, Reference);
+
+    Benchmark(bench_name, "NAMED_CRITICALS_1", TestNamedCriticals1, Reference);
+    Benchmark(bench_name, "NAMED_CRITICALS_4", TestNamedCriticals4, Reference);
+    Benchmark(bench_name, "NAMED_CRITICALS_16", TestNamedCriticals16, Reference);
+    Benchmark(bench_name, "NAMED_CRITICALS_64", TestNamedCriticals64, Reference);
     Benchmark(bench_name, "ATOMIC", TestAtomic, ReferenceAtomic);
     Benchmark(bench_name, "SINGLE", TestSingle, Reference);
     Benchmark(bench_name, "SINGLE_NOWAIT", TestSingleNowait, Reference);
     Benchmark(bench_name, "MASTER", TestMaster, Reference);
+    Benchmark(bench_name, "MASKED", TestMasked, Reference);
+    Benchmark(bench_name, "MASKED_FILTER", TestMaskedFilter, Reference);
+    Benchmark(bench_name, "SCOPE", TestScope, Reference);
+    Benchmark(bench_name, "SCOPE_NOWAIT", TestScopeNowait, Reference);
+    Benchmark(bench_name, "SCOPE_PRIVATE", TestScopePrivate, Reference);
+    Benchmark(bench_name, "SCOPE_REDUCTION", TestScopeReduction, Reference);
+
+    Benchmark(bench_name, "SECTIONS_1", TestSections1, Reference);
+    Benchmark(bench_name, "SECTIONS_2", TestSections2, Reference);
+    Benchmark(bench_name, "SECTIONS_4", TestSections4, Reference);
+    Benchmark(bench_name, "SECTIONS_8", TestSections8, Reference);
+    Benchmark(bench_name, "SECTIONS_16", TestSections16, Reference);
+    Benchmark(bench_name, "SECTIONS_NOWAIT_1", TestSectionsNowait1, Reference);
+    Benchmark(bench_name, "SECTIONS_NOWAIT_2", TestSectionsNowait2, Reference);
+    Benchmark(bench_name, "SECTIONS_NOWAIT_4", TestSectionsNowait4, Reference);
+    Benchmark(bench_name, "SECTIONS_NOWAIT_8", TestSectionsNowait8, Reference);
+    Benchmark(bench_name, "SECTIONS_NOWAIT_16", TestSectionsNowait16, Reference);
     Benchmark(bench_name, "BARRIER", TestBarrier, Reference);
+    Benchmark(bench_name, "BARRIER_CENTRAL", TestUserBarrier<CentralBarrier>, Reference);
+    Benchmark(bench_name, "BARRIER_COMBINING_TREE", TestUserBarrier<CombiningTreeBarrier>, Reference);
+    Benchmark(bench_name, "BARRIER_DISSEMINATION", TestUserBarrier<DisseminationBarrier>, Reference);
+    Benchmark(bench_name, "BARRIER_TOURNAMENT", TestUserBarrier<TournamentBarrier>, Reference);
+    Benchmark(bench_name, "BARRIER_HIERARCHICAL", TestUserBarrier<HierarchicalBarrier>, Reference);
     Benchmark(bench_name, "ORDERED", TestOrdered, Reference);
+
+    // the dependence distance of the sink has to be an integer literal, so every distance is its own test
+    Benchmark(bench_name, "DOACROSS_1D_1", TestDoacross1D1, Reference);
+    Benchmark(bench_name, "DOACROSS_1D_2", TestDoacross1D2, Reference);
+    Benchmark(bench_name, "DOACROSS_1D_4", TestDoacross1D4, Reference);
+    Benchmark(bench_name, "DOACROSS_1D_8", TestDoacross1D8, Reference);
+    Benchmark(bench_name, "TASK_WAVEFRONT_1D_1", TestTaskWavefront1D1, Reference);
+    Benchmark(bench_name, "TASK_WAVEFRONT_1D_2", TestTaskWavefront1D2, Reference);
+    Benchmark(bench_name, "TASK_WAVEFRONT_1D_4", TestTaskWavefront1D4, Reference);
+    Benchmark(bench_name, "TASK_WAVEFRONT_1D_8", TestTaskWavefront1D8, Reference);
+    Benchmark(bench_name, "DOACROSS_2D_1", TestDoacross2D1, Reference2D);
+    Benchmark(bench_name, "DOACROSS_2D_2", TestDoacross2D2, Reference2D);
+    Benchmark(bench_name, "DOACROSS_2D_4", TestDoacross2D4, Reference2D);
+    Benchmark(bench_name, "DOACROSS_2D_8", TestDoacross2D8, Reference2D);
+    Benchmark(bench_name, "TASK_WAVEFRONT_2D_1", TestTaskWavefront2D1, Reference2D);
+    Benchmark(bench_name, "TASK_WAVEFRONT_2D_2", TestTaskWavefront2D2, Reference2D);
+    Benchmark(bench_name, "TASK_WAVEFRONT_2D_4", TestTaskWavefront2D4, Reference2D);
+    Benchmark(bench_name, "TASK_WAVEFRONT_2D_8", TestTaskWavefront2D8, Reference2D);
 }
 
 
@@ -51,6 +177,363 @@ void TestLock(const DataPoint& data) {
     }
 }
 
+void TestCriticalFraction(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long inside = data.workload * critical_fraction / 100;
+    unsigned long outside = data.workload - inside;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for shared(iterations, inside, outside) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            {
+                DELAY(outside, i);
+            }
+            #pragma omp critical (crit_fraction)
+            {
+                DELAY(inside, i);
+            }
+        }
+    }
+}
+
+void TestLockFraction(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long inside = data.workload * critical_fraction / 100;
+    unsigned long outside = data.workload - inside;
+
+    omp_lock_t lock;
+    omp_init_lock(&lock);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for shared(iterations, inside, outside, lock) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            {
+                DELAY(outside, i);
+            }
+            omp_set_lock(&lock);
+            DELAY(inside, i);
+            omp_unset_lock(&lock);
+        }
+    }
+
+    omp_destroy_lock(&lock);
+}
+
+void TestOrderedFraction(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long inside = data.workload * critical_fraction / 100;
+    unsigned long outside = data.workload - inside;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for ordered shared(iterations, inside, outside) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            {
+                DELAY(outside, i);
+            }
+            #pragma omp ordered
+            {
+                DELAY(inside, i);
+            }
+        }
+    }
+}
+
+void TestNestLock(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    omp_nest_lock_t lock;
+    omp_init_nest_lock(&lock);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for shared(iterations, workload, lock) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            omp_set_nest_lock(&lock);
+            DELAY(workload, i);
+            omp_unset_nest_lock(&lock);
+        }
+    }
+
+    omp_destroy_nest_lock(&lock);
+}
+
+template<typename LOCK>
+void TestUserLock(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    LOCK lock;
+    // the nodes live as long as the lock, the CLH lock keeps pointers to them between the parallel regions
+    std::vector<typename LOCK::Node> nodes(threads);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, lock, nodes) default(none) num_threads(threads)
+        {
+            typename LOCK::Node &node = nodes[omp_get_thread_num()];
+            #pragma omp for
+            for (int i = 0; i < iterations; i++) {
+                lock.Acquire(node);
+                DELAY(workload, i);
+                lock.Release(node);
+            }
+        }
+    }
+}
+
+/// @brief The body of the critical section of the fairness measurement
+/// @return false if all acquisitions are done
+bool FairnessSection(FairnessState &state, int thread, unsigned long long iterations, unsigned long workload) {
+    double acquired = omp_get_wtime();
+    if (state.acquisitions >= iterations) {
+        return false;
+    }
+    if (state.last_owner >= 0 && state.last_owner != thread) {
+        state.handoffs++;
+        state.handoff_time += acquired - state.last_release;
+    }
+    state.counts[thread]++;
+    DELAY(workload, state.acquisitions);
+    state.acquisitions++;
+    state.last_owner = thread;
+    state.last_release = omp_get_wtime();
+    return true;
+}
+
+template<typename LOCK>
+void MeasureFairness(unsigned int threads, unsigned long long iterations, unsigned long workload, FairnessState &state) {
+    LOCK lock;
+    std::vector<typename LOCK::Node> nodes(threads);
+
+    #pragma omp parallel shared(iterations, workload, lock, nodes, state) default(none) num_threads(threads)
+    {
+        int thread = omp_get_thread_num();
+        typename LOCK::Node &node = nodes[thread];
+        bool running = true;
+        while (running) {
+            lock.Acquire(node);
+            running = FairnessSection(state, thread, iterations, workload);
+            lock.Release(node);
+        }
+    }
+}
+
+void MeasureFairnessCritical(unsigned int threads, unsigned long long iterations, unsigned long workload, FairnessState &state) {
+    #pragma omp parallel shared(iterations, workload, state) default(none) num_threads(threads)
+    {
+        int thread = omp_get_thread_num();
+        bool running = true;
+        while (running) {
+            #pragma omp critical (fairness)
+            {
+                running = FairnessSection(state, thread, iterations, workload);
+            }
+        }
+    }
+}
+
+void PrintLockFairness() {
+    if (QUIET) {
+        return;
+    }
+
+    unsigned long long iterations = NUMBER_OF_ITERATIONS.at(0);
+    unsigned long workload = AMOUNT_OF_WORKLOAD.at(0);
+
+    const std::vector<std::pair<std::string, void (*)(unsigned int, unsigned long long, unsigned long, FairnessState &)>> locks = {
+            {"CRITICAL_SECTION", MeasureFairnessCritical},
+            {"LOCK", MeasureFairness<OmpLock>},
+            {"NEST_LOCK", MeasureFairness<OmpNestLock>},
+            {"LOCK_TAS", MeasureFairness<TasLock>},
+            {"LOCK_TTAS_BACKOFF", MeasureFairness<TtasBackoffLock>},
+            {"LOCK_TICKET", MeasureFairness<TicketLock>},
+            {"LOCK_MCS", MeasureFairness<McsLock>},
+            {"LOCK_CLH", MeasureFairness<ClhLock>},
+            {"LOCK_COHORT", MeasureFairness<CohortLock>},
+    };
+
+    std::cout << "Name of test: LOCK_FAIRNESS" << std::endl;
+    std::cout << "Iterations: " << iterations << ", Workload in iterations: " << workload << std::endl;
+    std::cout << "Lock              | Threads | Min acquisitions | Max acquisitions | Jain's index | Handoffs | Handoff latency in ns" << std::endl;
+
+    for (const auto &lock : locks) {
+        for (unsigned int threads : NUMBER_OF_THREADS) {
+            FairnessState state;
+            state.counts.assign(threads, 0);
+            lock.second(threads, iterations, workload, state);
+
+            // Jain's fairness index: 1 if all threads acquired the lock equally often, 1/threads if only one did
+            double sum = 0;
+            double sum_of_squares = 0;
+            for (unsigned long long count : state.counts) {
+                sum += count;
+                sum_of_squares += (double) count * count;
+            }
+
+            std::cout << std::left << std::setw(17) << lock.first << std::right
+                      << " | " << std::setw(7) << threads
+                      << " | " << std::setw(16) << *std::min_element(state.counts.begin(), state.counts.end())
+                      << " | " << std::setw(16) << *std::max_element(state.counts.begin(), state.counts.end())
+                      << " | " << std::setw(12) << std::fixed << std::setprecision(3) << sum * sum / (threads * sum_of_squares)
+                      << " | " << std::setw(8) << state.handoffs
+                      << " | " << std::setw(21) << std::setprecision(1)
+                      << (state.handoffs > 0 ? state.handoff_time / state.handoffs * 1e9 : 0.0) << std::endl;
+        }
+    }
+    std::cout << "----------------------------------------------------------------------------" << std::endl;
+}
+
+void PrintSpeculationSupport() {
+    bool rtm = false;
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax, ebx, ecx, edx;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+        rtm = ebx & bit_RTM;
+    }
+#endif
+    if (!QUIET && !rtm) {
+        std::cout << "The CPU has no transactional memory, the speculative hints fall back to a nonspeculative lock" << std::endl;
+    }
+}
+
+void TestLockHint(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    omp_lock_t lock;
+#ifdef HAVE_OMP_LOCK_HINT
+    omp_init_lock_with_hint(&lock, lock_hint);
+#else
+    omp_init_lock(&lock);
+#endif
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for shared(iterations, workload, lock) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            omp_set_lock(&lock);
+            DELAY(workload, i);
+            omp_unset_lock(&lock);
+        }
+    }
+
+    omp_destroy_lock(&lock);
+}
+
+// The hint of a critical section has to be a constant expression, and all critical sections with the same name
+// need the same hint, so every hint gets its own test and name
+#define DEFINE_CRITICAL_HINT(NAME, HINT) \
+void TestCriticalHint##NAME(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel for shared(iterations, workload) default(none) num_threads(threads)) \
+        for (int i = 0; i < iterations; i++) { \
+            PRAGMA(omp critical (crit_hint_##NAME) hint(HINT)) \
+            { \
+                DELAY(workload, i); \
+            } \
+        } \
+    } \
+}
+
+DEFINE_CRITICAL_HINT(Uncontended, omp_sync_hint_uncontended)
+DEFINE_CRITICAL_HINT(Contended, omp_sync_hint_contended)
+DEFINE_CRITICAL_HINT(Speculative, omp_sync_hint_speculative)
+DEFINE_CRITICAL_HINT(Nonspeculative, omp_sync_hint_nonspeculative)
+
+void TestNestLockDepth(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    int depth = nest_depth;
+
+    omp_nest_lock_t lock;
+    omp_init_nest_lock(&lock);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for shared(iterations, workload, lock, depth) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            // only the first set has to wait for the lock, the others increment the nesting count of the owner
+            for (int level = 0; level < depth; level++) {
+                omp_set_nest_lock(&lock);
+            }
+            DELAY(workload, i);
+            for (int level = 0; level < depth; level++) {
+                omp_unset_nest_lock(&lock);
+            }
+        }
+    }
+
+    omp_destroy_nest_lock(&lock);
+}
+
+void TestTestLock(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    omp_lock_t lock;
+    omp_init_lock(&lock);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel for shared(iterations, workload, lock) default(none) num_threads(threads)
+        for (int i = 0; i < iterations; i++) {
+            while (!omp_test_lock(&lock)) {
+                CPU_RELAX();
+            }
+            DELAY(workload, i);
+            omp_unset_lock(&lock);
+        }
+    }
+
+    omp_destroy_lock(&lock);
+}
+
+// The critical sections of the named criticals tests are generated with NAMED_CRITICALS_<COUNT>,
+// the names are the base 4 digits of their index, e.g. crit_named_13 is the case 7 of NAMED_CRITICALS_16
+#define NAMED_CRITICAL(NAME, INDEX) \
+    case INDEX: \
+        PRAGMA(omp critical (NAME)) \
+        { \
+            DELAY(workload, i); \
+        } \
+        break;
+#define NAMED_CRITICALS_1(NAME, INDEX) NAMED_CRITICAL(NAME##0, (INDEX) * 4)
+#define NAMED_CRITICALS_4(NAME, INDEX) NAMED_CRITICAL(NAME##0, (INDEX) * 4) NAMED_CRITICAL(NAME##1, (INDEX) * 4 + 1) \
+        NAMED_CRITICAL(NAME##2, (INDEX) * 4 + 2) NAMED_CRITICAL(NAME##3, (INDEX) * 4 + 3)
+#define NAMED_CRITICALS_16(NAME, INDEX) NAMED_CRITICALS_4(NAME##0, (INDEX) * 4) NAMED_CRITICALS_4(NAME##1, (INDEX) * 4 + 1) \
+        NAMED_CRITICALS_4(NAME##2, (INDEX) * 4 + 2) NAMED_CRITICALS_4(NAME##3, (INDEX) * 4 + 3)
+#define NAMED_CRITICALS_64(NAME, INDEX) NAMED_CRITICALS_16(NAME##0, (INDEX) * 4) NAMED_CRITICALS_16(NAME##1, (INDEX) * 4 + 1) \
+        NAMED_CRITICALS_16(NAME##2, (INDEX) * 4 + 2) NAMED_CRITICALS_16(NAME##3, (INDEX) * 4 + 3)
+
+#define DEFINE_NAMED_CRITICALS(COUNT) \
+void TestNamedCriticals##COUNT(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel for shared(iterations, workload) default(none) num_threads(threads)) \
+        for (int i = 0; i < iterations; i++) { \
+            switch (i % COUNT) { \
+                NAMED_CRITICALS_##COUNT(crit_named_, 0) \
+            } \
+        } \
+    } \
+}
+
+DEFINE_NAMED_CRITICALS(1)
+DEFINE_NAMED_CRITICALS(4)
+DEFINE_NAMED_CRITICALS(16)
+DEFINE_NAMED_CRITICALS(64)
+
 void TestAtomic(const DataPoint& data) {
     unsigned int threads = data.threads;
     unsigned long long int iterations = data.iterations;
@@ -124,6 +607,163 @@ void TestMaster(const DataPoint& data) {
     }
 }
 
+void TestMasked(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, threads) default(none) num_threads(threads)
+        {
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                #pragma omp masked
+                {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestMaskedFilter(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, threads) default(none) num_threads(threads)
+        {
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                #pragma omp masked filter(threads - 1)
+                {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestScope(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, threads) default(none) num_threads(threads)
+        {
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                #pragma omp scope
+                {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestScopeNowait(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, threads) default(none) num_threads(threads)
+        {
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                #pragma omp scope nowait
+                {
+                    DELAY(workload, i);
+                }
+            }
+        }
+    }
+}
+
+void TestScopePrivate(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, threads) default(none) num_threads(threads)
+        {
+            int iteration;
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                #pragma omp scope private(iteration)
+                {
+                    iteration = i;
+                    DELAY(workload, iteration);
+                }
+            }
+        }
+    }
+}
+
+void TestScopeReduction(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        float sum = 0;
+        #pragma omp parallel shared(iterations, workload, threads, sum) default(none) num_threads(threads)
+        {
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                #pragma omp scope reduction(+ : sum)
+                {
+                    DELAY(workload, i);
+                    sum += DELAY_A;
+                }
+            }
+        }
+        if (sum < 0) {
+            printf("Negative sum\n");
+        }
+    }
+}
+
+// The sections of the sections tests, SECTIONS_<COUNT> generates COUNT sections
+#define SECTION \
+    PRAGMA(omp section) \
+    { \
+        DELAY(workload, round); \
+    }
+#define SECTIONS_1 SECTION
+#define SECTIONS_2 SECTIONS_1 SECTIONS_1
+#define SECTIONS_4 SECTIONS_2 SECTIONS_2
+#define SECTIONS_8 SECTIONS_4 SECTIONS_4
+#define SECTIONS_16 SECTIONS_8 SECTIONS_8
+
+#define DEFINE_SECTIONS(NAME, COUNT, CLAUSES) \
+void NAME##COUNT(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel shared(iterations, workload) default(none) num_threads(threads)) \
+        { \
+            for (int round = 0; round < ceil((double) iterations / COUNT); round++) { \
+                PRAGMA(omp sections CLAUSES) \
+                { \
+                    SECTIONS_##COUNT \
+                } \
+            } \
+        } \
+    } \
+}
+
+DEFINE_SECTIONS(TestSections, 1, )
+DEFINE_SECTIONS(TestSections, 2, )
+DEFINE_SECTIONS(TestSections, 4, )
+DEFINE_SECTIONS(TestSections, 8, )
+DEFINE_SECTIONS(TestSections, 16, )
+DEFINE_SECTIONS(TestSectionsNowait, 1, nowait)
+DEFINE_SECTIONS(TestSectionsNowait, 2, nowait)
+DEFINE_SECTIONS(TestSectionsNowait, 4, nowait)
+DEFINE_SECTIONS(TestSectionsNowait, 8, nowait)
+DEFINE_SECTIONS(TestSectionsNowait, 16, nowait)
+
 void TestBarrier(const DataPoint& data) {
     unsigned int threads = data.threads;
     unsigned long long int iterations = data.iterations;
@@ -140,6 +780,26 @@ void TestBarrier(const DataPoint& data) {
     }
 }
 
+template<typename BARRIER>
+void TestUserBarrier(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    BARRIER barrier(threads);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel shared(iterations, workload, threads, barrier) default(none) num_threads(threads)
+        {
+            unsigned int thread = omp_get_thread_num();
+            for (int i = 0; i < ceil((double) iterations / (double) threads); i++) {
+                DELAY(workload, i);
+                barrier.Wait(thread);
+            }
+        }
+    }
+}
+
 void TestOrdered(const DataPoint& data) {
     unsigned int threads = data.threads;
     unsigned long long int iterations = data.iterations;
@@ -149,11 +809,109 @@ void TestOrdered(const DataPoint& data) {
         #pragma omp parallel for ordered shared(iterations, workload) default(none) num_threads(threads)
         for (int i = 0; i < iterations; i++) {
             #pragma omp ordered
-            DELAY(workload, i);
+            {
+                DELAY(workload, i);
+            }
         }
     }
 }
 
+// The doacross loops and their task wavefronts for the dependence distance DISTANCE.
+// The OpenMP 5.2 doacross clause is not supported by all compilers yet, so they use depend(sink) and depend(source)
+#define DEFINE_DOACROSS(DISTANCE) \
+void TestDoacross1D##DISTANCE(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        /* round robin, so that DISTANCE iterations can run at the same time */ \
+        PRAGMA(omp parallel for ordered(1) schedule(static, 1) shared(iterations, workload) default(none) num_threads(threads)) \
+        for (int i = 0; i < iterations; i++) { \
+            PRAGMA(omp ordered depend(sink: i - DISTANCE)) \
+            DELAY(workload, i); \
+            PRAGMA(omp ordered depend(source)) \
+        } \
+    } \
+} \
+\
+void TestDoacross2D##DISTANCE(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    int size = (int) sqrt((double) iterations); \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        /* the loops are collapsed, the chunks of size iterations are the rows, round robin over the threads */ \
+        PRAGMA(omp parallel for collapse(2) ordered(2) schedule(static, size) shared(size, workload) default(none) num_threads(threads)) \
+        for (int i = 0; i < size; i++) { \
+            for (int j = 0; j < size; j++) { \
+                PRAGMA(omp ordered depend(sink: i - DISTANCE, j) depend(sink: i, j - 1)) \
+                DELAY(workload, i * size + j); \
+                PRAGMA(omp ordered depend(source)) \
+            } \
+        } \
+    } \
+} \
+\
+void TestTaskWavefront1D##DISTANCE(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    char *cells = wavefront_cells.data(); /* only named in the depend clauses */ \
+    (void) cells; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel shared(iterations, workload, cells) default(none) num_threads(threads)) \
+        { \
+            PRAGMA(omp master) \
+            { \
+                for (int i = 0; i < iterations; i++) { \
+                    int before = i >= DISTANCE ? i - DISTANCE : iterations; \
+                    PRAGMA(omp task firstprivate(i) shared(workload, cells) depend(in: cells[before]) depend(out: cells[i]) default(none)) \
+                    { \
+                        DELAY(workload, i); \
+                    } \
+                } \
+            } \
+        } \
+    } \
+} \
+\
+void TestTaskWavefront2D##DISTANCE(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+    int size = (int) sqrt((double) iterations); \
+    char *cells = wavefront_cells.data(); /* only named in the depend clauses */ \
+    (void) cells; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel shared(iterations, size, workload, cells) default(none) num_threads(threads)) \
+        { \
+            PRAGMA(omp master) \
+            { \
+                for (int i = 0; i < size; i++) { \
+                    for (int j = 0; j < size; j++) { \
+                        int above = i >= DISTANCE ? (i - DISTANCE) * size + j : iterations; \
+                        int left = j >= 1 ? i * size + j - 1 : iterations; \
+                        PRAGMA(omp task firstprivate(i, j) shared(size, workload, cells) default(none) \
+                               depend(in: cells[above], cells[left]) depend(out: cells[i * size + j])) \
+                        { \
+                            DELAY(workload, i * size + j); \
+                        } \
+                    } \
+                } \
+            } \
+        } \
+    } \
+}
+
+DEFINE_DOACROSS(1)
+DEFINE_DOACROSS(2)
+DEFINE_DOACROSS(4)
+DEFINE_DOACROSS(8)
+
 void Reference(const DataPoint& data) {
     unsigned int threads = data.threads; // not used, only here for equal work in Test and Reference
     unsigned long long int iterations = data.iterations;
@@ -166,6 +924,37 @@ void Reference(const DataPoint& data) {
     }
 }
 
+void ReferenceFraction(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long inside = data.workload * critical_fraction / 100;
+    unsigned long outside = data.workload - inside;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < iterations; i++) {
+            {
+                DELAY(outside, i);
+            }
+            DELAY(inside, i);
+        }
+    }
+}
+
+void Reference2D(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    int size = (int) sqrt((double) iterations);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                DELAY(workload, i * size + j);
+            }
+        }
+    }
+}
+
 void ReferenceAtomic(const DataPoint& data) {
     unsigned int threads = data.threads; // not used, only here for equal work in Test and Reference
     unsigned long long int iterations = data.iterations;
@@ -193,6 +982,8 @@ int main(int argc, char **argv) {
         RemoveBench(bench_name);
     }
 
+    wavefront_cells.resize(*std::max_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end()) + 1);
+
     RunBenchmarks();
 
     return 0;
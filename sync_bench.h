@@ -11,6 +11,42 @@ void TestCriticalSection(const DataPoint& data);
 /// @param data the configuration for the microbenchmark
 void TestLock(const DataPoint& data);
 
+/// @brief Synchronisation with the computation being wrapped in a nestable lock, acquired with nesting depth 1
+/// @param data the configuration for the microbenchmark
+void TestNestLock(const DataPoint& data);
+
+/// @brief Synchronisation with the computation being wrapped in one of the user-space locks from sync_locks.h,
+/// every thread passes its own node of the lock
+/// @param data the configuration for the microbenchmark
+template<typename LOCK>
+void TestUserLock(const DataPoint& data);
+
+/// @brief Synchronisation with a lock initialized with omp_init_lock_with_hint, the hint is set before the test
+/// @param data the configuration for the microbenchmark
+void TestLockHint(const DataPoint& data);
+
+/// @brief Synchronisation with a named critical section with the hint uncontended, contended, speculative or nonspeculative
+/// @param data the configuration for the microbenchmark
+void TestCriticalHintUncontended(const DataPoint& data);
+void TestCriticalHintContended(const DataPoint& data);
+void TestCriticalHintSpeculative(const DataPoint& data);
+void TestCriticalHintNonspeculative(const DataPoint& data);
+
+/// @brief Synchronisation with a nestable lock, acquired recursively up to the nesting depth set before the test
+/// @param data the configuration for the microbenchmark
+void TestNestLockDepth(const DataPoint& data);
+
+/// @brief Synchronisation with a lock, acquired by polling with omp_test_lock
+/// @param data the configuration for the microbenchmark
+void TestTestLock(const DataPoint& data);
+
+/// @brief Synchronisation with 1, 4, 16 or 64 distinct named critical sections, iteration i uses the section i % count
+/// @param data the configuration for the microbenchmark
+void TestNamedCriticals1(const DataPoint& data);
+void TestNamedCriticals4(const DataPoint& data);
+void TestNamedCriticals16(const DataPoint& data);
+void TestNamedCriticals64(const DataPoint& data);
+
 /// @brief Synchronisation with an atomic arithmetic operation on a shared variable after the computation
 /// @param data the configuration for the microbenchmark
 void TestAtomic(const DataPoint& data);
@@ -27,18 +63,107 @@ void TestSingleNowait(const DataPoint& data);
 /// @param data the configuration for the microbenchmark
 void TestMaster(const DataPoint& data);
 
+/// @brief Synchronisation with the primary thread doing the calculations, with masked (OpenMP 5.1 replacement of master)
+/// @param data the configuration for the microbenchmark
+void TestMasked(const DataPoint& data);
+
+/// @brief Synchronisation with the last thread doing the calculations, with masked filter(threads - 1)
+/// @param data the configuration for the microbenchmark
+void TestMaskedFilter(const DataPoint& data);
+
+/// @brief Every thread does its calculations in a scope (OpenMP 5.1), which ends with a barrier
+/// @param data the configuration for the microbenchmark
+void TestScope(const DataPoint& data);
+
+/// @brief The same as TestScope, with nowait
+/// @param data the configuration for the microbenchmark
+void TestScopeNowait(const DataPoint& data);
+
+/// @brief The same as TestScope, with a private variable
+/// @param data the configuration for the microbenchmark
+void TestScopePrivate(const DataPoint& data);
+
+/// @brief The same as TestScope, with a sum reduction over the results of the calculations
+/// @param data the configuration for the microbenchmark
+void TestScopeReduction(const DataPoint& data);
+
+/// @brief A sections construct with 1, 2, 4, 8 or 16 sections, repeated until every iteration was calculated in a section
+/// @param data the configuration for the microbenchmark
+void TestSections1(const DataPoint& data);
+void TestSections2(const DataPoint& data);
+void TestSections4(const DataPoint& data);
+void TestSections8(const DataPoint& data);
+void TestSections16(const DataPoint& data);
+
+/// @brief The same as TestSections, with nowait
+/// @param data the configuration for the microbenchmark
+void TestSectionsNowait1(const DataPoint& data);
+void TestSectionsNowait2(const DataPoint& data);
+void TestSectionsNowait4(const DataPoint& data);
+void TestSectionsNowait8(const DataPoint& data);
+void TestSectionsNowait16(const DataPoint& data);
+
 /// @brief Synchronisation with barrier after every loop iteration
 /// @param data the configuration for the microbenchmark
 void TestBarrier(const DataPoint& data);
 
+/// @brief Synchronisation with one of the user-space barriers from sync_barriers.h after every loop iteration
+/// @param data the configuration for the microbenchmark
+template<typename BARRIER>
+void TestUserBarrier(const DataPoint& data);
+
 /// @brief Synchronisation with the DoAll loop being ordered and ordered directive
 /// @param data the configuration for the microbenchmark
 void TestOrdered(const DataPoint& data);
 
+/// @brief Doacross loop with ordered(1), every iteration waits with depend(sink) for the iteration 1, 2, 4 or 8 before
+/// @param data the configuration for the microbenchmark
+void TestDoacross1D1(const DataPoint& data);
+void TestDoacross1D2(const DataPoint& data);
+void TestDoacross1D4(const DataPoint& data);
+void TestDoacross1D8(const DataPoint& data);
+
+/// @brief Doacross loop with ordered(2) over a square of iterations cells, every cell waits for the cell 1, 2, 4 or 8 rows above
+/// and for the cell to the left, the rows are distributed round robin
+/// @param data the configuration for the microbenchmark
+void TestDoacross2D1(const DataPoint& data);
+void TestDoacross2D2(const DataPoint& data);
+void TestDoacross2D4(const DataPoint& data);
+void TestDoacross2D8(const DataPoint& data);
+
+/// @brief The same dependencies as TestDoacross1D, with one task per iteration and task dependencies
+/// @param data the configuration for the microbenchmark
+void TestTaskWavefront1D1(const DataPoint& data);
+void TestTaskWavefront1D2(const DataPoint& data);
+void TestTaskWavefront1D4(const DataPoint& data);
+void TestTaskWavefront1D8(const DataPoint& data);
+
+/// @brief The same dependencies as TestDoacross2D, with one task per cell and task dependencies
+/// @param data the configuration for the microbenchmark
+void TestTaskWavefront2D1(const DataPoint& data);
+void TestTaskWavefront2D2(const DataPoint& data);
+void TestTaskWavefront2D4(const DataPoint& data);
+void TestTaskWavefront2D8(const DataPoint& data);
+
+/// @brief The workload of every iteration is split into a part outside and a part inside of a critical section,
+/// a lock or an ordered region, the percentage inside is set before the test
+/// @param data the configuration for the microbenchmark
+void TestCriticalFraction(const DataPoint& data);
+void TestLockFraction(const DataPoint& data);
+void TestOrderedFraction(const DataPoint& data);
+
 /// @brief Reference implementation for overhead calculation
 /// @param data the configuration for the reference
 void Reference(const DataPoint& data);
 
+/// @brief Reference implementation for the tests with a critical fraction, the same split of the workload
+/// @param data the configuration for the reference
+void ReferenceFraction(const DataPoint& data);
+
+/// @brief Reference implementation for the 2D doacross loops, the workload for every cell of the square
+/// @param data the configuration for the reference
+void Reference2D(const DataPoint& data);
+
 /// @brief Reference implementation for overhead calculation for the atomic directive
 /// @param data the configuration for the reference
 void ReferenceAtomic(const DataPoint& data);
@@ -0,0 +1,290 @@
+#ifndef PPT_P4_SYNC_LOCKS_H
+#define PPT_P4_SYNC_LOCKS_H
+
+#include <omp.h>
+#include <atomic>
+#include <vector>
+
+// User-space lock implementations for sync_bench. All locks have the same interface:
+// every thread owns one LOCK::Node for the whole lifetime of the lock and passes it to Acquire and Release.
+// The nodes and the hot variables of the locks are padded, so that two of them never share a cache line.
+
+#define CACHE_LINE_SIZE 64
+
+#if defined(__x86_64__) || defined(__i386__)
+    #define CPU_RELAX() __builtin_ia32_pause()
+#else
+    #define CPU_RELAX()
+#endif
+
+/// @brief Test-and-set lock, every waiting thread writes the lock variable
+class TasLock {
+public:
+    struct Node {};
+
+    void Acquire(Node &node) {
+        while (locked.exchange(true, std::memory_order_acquire)) {
+            CPU_RELAX();
+        }
+    }
+
+    void Release(Node &node) {
+        locked.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<bool> locked{false};
+    char padding[CACHE_LINE_SIZE];
+};
+
+/// @brief Test-and-test-and-set lock with exponential backoff, the waiting threads only read the lock variable
+class TtasBackoffLock {
+public:
+    struct Node {};
+
+    void Acquire(Node &node) {
+        unsigned int backoff = MIN_BACKOFF;
+        while (true) {
+            while (locked.load(std::memory_order_relaxed)) {
+                CPU_RELAX();
+            }
+            if (!locked.exchange(true, std::memory_order_acquire)) {
+                return;
+            }
+            for (unsigned int i = 0; i < backoff; i++) {
+                CPU_RELAX();
+            }
+            backoff = backoff < MAX_BACKOFF ? backoff * 2 : MAX_BACKOFF;
+        }
+    }
+
+    void Release(Node &node) {
+        locked.store(false, std::memory_order_release);
+    }
+
+private:
+    static const unsigned int MIN_BACKOFF = 4;
+    static const unsigned int MAX_BACKOFF = 1024;
+
+    std::atomic<bool> locked{false};
+    char padding[CACHE_LINE_SIZE];
+};
+
+/// @brief Ticket lock, the threads get the lock in the order they arrived (FIFO)
+class TicketLock {
+public:
+    struct Node {};
+
+    void Acquire(Node &node) {
+        unsigned int ticket = next_ticket.fetch_add(1, std::memory_order_relaxed);
+        while (now_serving.load(std::memory_order_acquire) != ticket) {
+            CPU_RELAX();
+        }
+    }
+
+    void Release(Node &node) {
+        // only the owner writes now_serving
+        now_serving.store(now_serving.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /// @brief Whether other threads wait for the lock, only valid for the owner
+    bool HasWaiters() {
+        return next_ticket.load(std::memory_order_relaxed) - now_serving.load(std::memory_order_relaxed) > 1;
+    }
+
+private:
+    std::atomic<unsigned int> next_ticket{0};
+    char padding_next_ticket[CACHE_LINE_SIZE];
+    std::atomic<unsigned int> now_serving{0};
+    char padding_now_serving[CACHE_LINE_SIZE];
+};
+
+/// @brief MCS queue lock, every thread spins on the flag of its own node, the owner hands the lock to its successor
+class McsLock {
+public:
+    struct Node {
+        std::atomic<Node *> next{nullptr};
+        std::atomic<bool> locked{false};
+        char padding[CACHE_LINE_SIZE];
+    };
+
+    void Acquire(Node &node) {
+        node.next.store(nullptr, std::memory_order_relaxed);
+        node.locked.store(true, std::memory_order_relaxed);
+
+        Node *predecessor = tail.exchange(&node, std::memory_order_acq_rel);
+        if (predecessor != nullptr) {
+            predecessor->next.store(&node, std::memory_order_release);
+            while (node.locked.load(std::memory_order_acquire)) {
+                CPU_RELAX();
+            }
+        }
+    }
+
+    void Release(Node &node) {
+        Node *successor = node.next.load(std::memory_order_acquire);
+        if (successor == nullptr) {
+            Node *expected = &node;
+            if (tail.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)) {
+                return;
+            }
+            // a successor swapped the tail, but is not linked yet
+            while ((successor = node.next.load(std::memory_order_acquire)) == nullptr) {
+                CPU_RELAX();
+            }
+        }
+        successor->locked.store(false, std::memory_order_release);
+    }
+
+private:
+    std::atomic<Node *> tail{nullptr};
+    char padding[CACHE_LINE_SIZE];
+};
+
+/// @brief CLH queue lock, every thread spins on the flag of its predecessor.
+/// The queue nodes move between the threads: after a release the thread continues with the node of its predecessor
+class ClhLock {
+public:
+    struct QueueNode {
+        std::atomic<bool> locked{false};
+        char padding[CACHE_LINE_SIZE];
+    };
+
+    struct Node {
+        QueueNode own;
+        QueueNode *current = nullptr;
+        QueueNode *predecessor = nullptr;
+    };
+
+    ClhLock() {
+        tail.store(&initial, std::memory_order_relaxed);
+    }
+
+    void Acquire(Node &node) {
+        if (node.current == nullptr) {
+            node.current = &node.own;
+        }
+        node.current->locked.store(true, std::memory_order_relaxed);
+        node.predecessor = tail.exchange(node.current, std::memory_order_acq_rel);
+        while (node.predecessor->locked.load(std::memory_order_acquire)) {
+            CPU_RELAX();
+        }
+    }
+
+    void Release(Node &node) {
+        node.current->locked.store(false, std::memory_order_release);
+        node.current = node.predecessor;
+    }
+
+private:
+    QueueNode initial;
+    std::atomic<QueueNode *> tail{nullptr};
+    char padding[CACHE_LINE_SIZE];
+};
+
+/// @brief Cohort lock (C-TKT-TKT): a ticket lock per place and a global ticket lock.
+/// The owner passes the global lock to a waiting thread of the same place up to MAX_PASSES times,
+/// so the lock stays on one socket while there are waiting threads (with OMP_PLACES=sockets or numa_domains)
+class CohortLock {
+public:
+    struct Node {
+        int cohort = -1;
+    };
+
+    CohortLock() : cohorts(omp_get_num_places() > 0 ? omp_get_num_places() : 1) {}
+
+    void Acquire(Node &node) {
+        if (node.cohort < 0) {
+            // -1 without places, then all threads are in the same cohort
+            int place = omp_get_place_num();
+            node.cohort = place < 0 ? 0 : place % cohorts.size();
+        }
+
+        Cohort &cohort = cohorts[node.cohort];
+        TicketLock::Node ticket_node;
+        cohort.local.Acquire(ticket_node);
+        if (!cohort.owns_global) {
+            global.Acquire(ticket_node);
+            cohort.owns_global = true;
+        }
+    }
+
+    void Release(Node &node) {
+        // owns_global and passes are only accessed by the owner of the local lock
+        Cohort &cohort = cohorts[node.cohort];
+        TicketLock::Node ticket_node;
+        if (cohort.local.HasWaiters() && cohort.passes < MAX_PASSES) {
+            cohort.passes++;
+        } else {
+            cohort.passes = 0;
+            cohort.owns_global = false;
+            global.Release(ticket_node);
+        }
+        cohort.local.Release(ticket_node);
+    }
+
+private:
+    static const int MAX_PASSES = 64;
+
+    struct Cohort {
+        TicketLock local;
+        bool owns_global = false;
+        int passes = 0;
+        char padding[CACHE_LINE_SIZE];
+    };
+
+    TicketLock global;
+    std::vector<Cohort> cohorts;
+};
+
+/// @brief omp_lock_t with the interface of the user-space locks
+class OmpLock {
+public:
+    struct Node {};
+
+    OmpLock() {
+        omp_init_lock(&lock);
+    }
+
+    ~OmpLock() {
+        omp_destroy_lock(&lock);
+    }
+
+    void Acquire(Node &node) {
+        omp_set_lock(&lock);
+    }
+
+    void Release(Node &node) {
+        omp_unset_lock(&lock);
+    }
+
+private:
+    omp_lock_t lock;
+};
+
+/// @brief omp_nest_lock_t with the interface of the user-space locks, always acquired with nesting depth 1
+class OmpNestLock {
+public:
+    struct Node {};
+
+    OmpNestLock() {
+        omp_init_nest_lock(&lock);
+    }
+
+    ~OmpNestLock() {
+        omp_destroy_nest_lock(&lock);
+    }
+
+    void Acquire(Node &node) {
+        omp_set_nest_lock(&lock);
+    }
+
+    void Release(Node &node) {
+        omp_unset_nest_lock(&lock);
+    }
+
+private:
+    omp_nest_lock_t lock;
+};
+
+#endif //PPT_P4_SYNC_LOCKS_H
@@ -1,11 +1,30 @@
+#include <omp.h>
+#include <algorithm>
 #include <cmath>
+#include <iostream>
+#include <iomanip>
 #include "task_bench.h"
 #include "commons.h"
 
 void RunBenchmarks();
 
+/// @brief Prints how well the runtime follows the task priorities.
+/// The master creates a batch of low priority tasks followed by a batch of high priority tasks,
+/// the ratio of high priority tasks in the first half of the executed tasks is printed (100% is ideal, 50% means ignored)
+void PrintPriorityOrdering();
+
 std::string bench_name = "TASK";
 
+int task_priority = 0;
+
+// The events of the detached tasks in the order they were published to the completion thread,
+// ready_events marks the positions which are already written
+std::vector<omp_event_handle_t> events;
+std::vector<int> ready_events;
+unsigned long long batch_size = 1;
+
+#define IDLE_POLLS 1000
+
 int main(int argc, char **argv) {
 
     ParseArgs(argc, argv);
@@ -16,6 +35,9 @@ int main(int argc, char **argv) {
         RemoveBench(bench_name);
     }
 
+    events.resize(*std::max_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end()));
+    ready_events.resize(events.size());
+
     RunBenchmarks();
 
     return 0;
@@ -33,6 +55,35 @@ void RunBenchmarks() {
     Benchmark(bench_name, "CONDITIONAL_TRUE", TestTaskConditionalTrue, Reference);
     Benchmark(bench_name, "CONDITIONAL_FALSE", TestTaskConditionalFalse, Reference);
 
+    // the maximum priority can only be set with the environment variable OMP_MAX_TASK_PRIORITY
+    for (int priority = 0; priority <= omp_get_max_task_priority(); priority = priority == 0 ? 1 : priority * 2) {
+        task_priority = priority;
+        Benchmark(bench_name, "PRIORITY_" + std::to_string(priority), TestTaskPriority, Reference);
+    }
+    Benchmark(bench_name, "PRIORITY_MIXED", TestTaskPriorityMixed, Reference);
+    PrintPriorityOrdering();
+
+    Benchmark(bench_name, "CHILD_WAIT_TIED", TestTaskChildWaitTied, Reference);
+    Benchmark(bench_name, "CHILD_WAIT_UNTIED", TestTaskChildWaitUntied, Reference);
+    Benchmark(bench_name, "YIELD_TIED", TestTaskYieldTied, Reference);
+    Benchmark(bench_name, "YIELD_UNTIED", TestTaskYieldUntied, Reference);
+    Benchmark(bench_name, "LOCK_SPIN", TestTaskLockSpin, Reference);
+    Benchmark(bench_name, "LOCK_YIELD", TestTaskLockYield, Reference);
+
+    // compared to MASTER, which creates the same tasks without detach
+    Benchmark(bench_name, "DETACH_IMMEDIATE", TestTaskDetachImmediate, Reference);
+    unsigned long long minimum_iterations = *std::min_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end());
+    for (unsigned long long batch = 1; batch <= minimum_iterations; batch = batch * 4) {
+        batch_size = batch;
+        Benchmark(bench_name, "DETACH_BATCH_" + std::to_string(batch), TestTaskDetachBatch, Reference);
+    }
+    // the workload is done by the completion thread alone, so the whole reference is serial
+    batch_size = 1;
+    Benchmark(bench_name, "DETACH_DELAYED", TestTaskDetachDelayed, Reference, {}, 1.0);
+    // the difference of both tests is the latency from the fulfillment of an event to the start of the dependent task
+    batch_size = 1;
+    Benchmark(bench_name, "CHAIN", TestTaskChain, Reference);
+    Benchmark(bench_name, "DETACH_CHAIN", TestTaskDetachChain, Reference);
 }
 
 
@@ -191,6 +242,442 @@ void TestTaskConditionalFalse(const DataPoint& data) {
     }
 }
 
+void TestTaskPriority(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, task_priority) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task firstprivate(i) shared(workload) priority(task_priority) default(none)
+                    {
+                        DELAY(workload, i);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskPriorityMixed(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    int max_priority = omp_get_max_task_priority();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, max_priority) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task firstprivate(i) shared(workload) priority(i % 2 == 0 ? 0 : max_priority) default(none)
+                    {
+                        DELAY(workload, i);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PrintPriorityOrdering() {
+    int max_priority = omp_get_max_task_priority();
+
+    if (QUIET) {
+        return;
+    }
+    if (max_priority == 0) {
+        std::cout << "Priority ordering not measured, the maximum task priority is 0 (set OMP_MAX_TASK_PRIORITY)" << std::endl;
+        return;
+    }
+
+    unsigned long long iterations = NUMBER_OF_ITERATIONS.at(0);
+    unsigned long workload = AMOUNT_OF_WORKLOAD.at(0);
+
+    std::cout << "Name of test: PRIORITY_ORDERING" << std::endl;
+    std::cout << "Threads | Iterations | Workload in iterations | High priority tasks in the first half " << std::endl;
+
+    for (unsigned int threads : NUMBER_OF_THREADS) {
+        unsigned long long executed = 0;
+        unsigned long long high_priority_first = 0;
+
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, max_priority, executed, high_priority_first) default(none)
+        {
+            #pragma omp master
+            {
+                for (unsigned long long i = 0; i < iterations; i++) {
+                    bool high_priority = i >= iterations / 2;
+                    #pragma omp task firstprivate(i, high_priority) shared(workload, iterations, executed, high_priority_first) priority(high_priority ? max_priority : 0) default(none)
+                    {
+                        unsigned long long position;
+                        #pragma omp atomic capture
+                        position = executed++;
+
+                        if (high_priority && position < iterations / 2) {
+                            #pragma omp atomic
+                            high_priority_first++;
+                        }
+                        DELAY(workload, i);
+                    }
+                }
+            }
+        }
+
+        std::cout << std::setw(7) << threads
+                  << " | " << std::setw(10) << iterations
+                  << " | " << std::setw(22) << workload
+                  << " | " << std::setw(36) << std::fixed << std::setprecision(2)
+                  << 100.0 * high_priority_first / (iterations - iterations / 2) << " %" << std::endl;
+    }
+    std::cout << "----------------------------------------------------------------------------" << std::endl;
+}
+
+void TestTaskChildWaitTied(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task firstprivate(i) shared(workload) default(none)
+                    {
+                        #pragma omp task firstprivate(i) shared(workload) default(none)
+                        {
+                            DELAY(workload, i);
+                        }
+                        // a tied task can only be resumed by the thread it was suspended on
+                        #pragma omp taskwait
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskChildWaitUntied(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task untied firstprivate(i) shared(workload) default(none)
+                    {
+                        #pragma omp task firstprivate(i) shared(workload) default(none)
+                        {
+                            DELAY(workload, i);
+                        }
+                        #pragma omp taskwait
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskYieldTied(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task firstprivate(i) shared(workload) default(none)
+                    {
+                        DELAY(workload, i);
+                        #pragma omp taskyield
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskYieldUntied(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task untied firstprivate(i) shared(workload) default(none)
+                    {
+                        DELAY(workload, i);
+                        #pragma omp taskyield
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskLockSpin(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    omp_lock_t lock;
+    omp_init_lock(&lock);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, lock) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task firstprivate(i) shared(workload, lock) default(none)
+                    {
+                        while (!omp_test_lock(&lock)) {
+                            // busy waiting, the thread can't do anything else in the meantime
+                        }
+                        DELAY(workload, i);
+                        omp_unset_lock(&lock);
+                    }
+                }
+            }
+        }
+    }
+
+    omp_destroy_lock(&lock);
+}
+
+void TestTaskLockYield(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    omp_lock_t lock;
+    omp_init_lock(&lock);
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, lock) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task firstprivate(i) shared(workload, lock) default(none)
+                    {
+                        while (!omp_test_lock(&lock)) {
+                            #pragma omp taskyield
+                        }
+                        DELAY(workload, i);
+                        omp_unset_lock(&lock);
+                    }
+                }
+            }
+        }
+    }
+
+    omp_destroy_lock(&lock);
+}
+
+void TestTaskDetachImmediate(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    omp_event_handle_t event;
+                    #pragma omp task detach(event) firstprivate(i) shared(workload) default(none)
+                    {
+                        DELAY(workload, i);
+                        omp_fulfill_event(event);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// @brief Executed by the completion thread, fulfills the events in the order they were published by the detached tasks.
+/// The events are fulfilled in batches of batch_size, a smaller batch is fulfilled if no event was published for IDLE_POLLS polls,
+/// otherwise a task executed undeferred by a blocked thread could wait forever for its batch
+/// @param delay the workload done before every event is fulfilled, like an asynchronous operation finishing later
+void FulfillEvents(unsigned long long iterations, unsigned long long *published, omp_event_handle_t *event_handles, int *ready,
+                   unsigned long delay = 0) {
+    unsigned long long fulfilled = 0;
+    unsigned long long idle = 0;
+    unsigned long long last_available = 0;
+
+    while (fulfilled < iterations) {
+        unsigned long long available;
+        #pragma omp atomic read
+        available = *published;
+
+        idle = available == last_available ? idle + 1 : 0;
+        last_available = available;
+
+        if (available - fulfilled >= batch_size || available == iterations || (available > fulfilled && idle >= IDLE_POLLS)) {
+            for (; fulfilled < available; fulfilled++) {
+                // the position is taken before the event is stored, wait until it is visible
+                int is_ready = 0;
+                while (!is_ready) {
+                    #pragma omp atomic read acquire
+                    is_ready = ready[fulfilled];
+                }
+                ready[fulfilled] = 0;
+                if (delay > 0) {
+                    DELAY(delay, fulfilled);
+                }
+                omp_fulfill_event(event_handles[fulfilled]);
+            }
+        }
+    }
+}
+
+/// @brief Called at the end of a detached task, stores the event for the completion thread
+void PublishEvent(omp_event_handle_t event, unsigned long long *published, omp_event_handle_t *event_handles, int *ready) {
+    unsigned long long position;
+    #pragma omp atomic capture
+    position = (*published)++;
+
+    event_handles[position] = event;
+    #pragma omp atomic write release
+    ready[position] = 1;
+}
+
+void TestTaskDetachBatch(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    omp_event_handle_t *event_handles = events.data();
+    int *ready = ready_events.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        unsigned long long published = 0;
+        // the additional thread is the completion thread, it does not execute tasks until all events are fulfilled
+        #pragma omp parallel num_threads(threads + 1) shared(threads, iterations, workload, published, event_handles, ready) default(none)
+        {
+            if (omp_get_thread_num() == threads) {
+                FulfillEvents(iterations, &published, event_handles, ready);
+            }
+
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    omp_event_handle_t event;
+                    #pragma omp task detach(event) firstprivate(i) shared(workload, published, event_handles, ready) default(none)
+                    {
+                        DELAY(workload, i);
+                        PublishEvent(event, &published, event_handles, ready);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskDetachDelayed(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    omp_event_handle_t *event_handles = events.data();
+    int *ready = ready_events.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        unsigned long long published = 0;
+        #pragma omp parallel num_threads(threads + 1) shared(threads, iterations, workload, published, event_handles, ready) default(none)
+        {
+            if (omp_get_thread_num() == threads) {
+                FulfillEvents(iterations, &published, event_handles, ready, workload);
+            }
+
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    omp_event_handle_t event;
+                    // the task only starts the operation, the completion thread does the workload before the fulfillment
+                    #pragma omp task detach(event) shared(published, event_handles, ready) default(none)
+                    {
+                        PublishEvent(event, &published, event_handles, ready);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskChain(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char chain = 0;
+        // the additional thread does not do anything, so that the team is the same as in TestTaskDetachChain
+        #pragma omp parallel num_threads(threads + 1) shared(iterations, workload, chain) default(none)
+        {
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    #pragma omp task depend(inout : chain) firstprivate(i) shared(workload) default(none)
+                    {
+                        DELAY(workload, i);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskDetachChain(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    omp_event_handle_t *event_handles = events.data();
+    int *ready = ready_events.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char chain = 0;
+        unsigned long long published = 0;
+        #pragma omp parallel num_threads(threads + 1) shared(threads, iterations, workload, chain, published, event_handles, ready) default(none)
+        {
+            if (omp_get_thread_num() == threads) {
+                FulfillEvents(iterations, &published, event_handles, ready);
+            }
+
+            #pragma omp master
+            {
+                for (int i = 0; i < iterations; i++) {
+                    omp_event_handle_t event;
+                    // the next task of the chain can only start after the completion thread fulfilled the event
+                    #pragma omp task depend(inout : chain) detach(event) firstprivate(i) shared(workload, published, event_handles, ready) default(none)
+                    {
+                        DELAY(workload, i);
+                        PublishEvent(event, &published, event_handles, ready);
+                    }
+                }
+            }
+        }
+    }
+}
+
 void Reference(const DataPoint& data) {
     unsigned int threads = data.threads; // // not used, only here for equal amount of work in Test and Reference
     unsigned long long int iterations = data.iterations;
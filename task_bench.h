@@ -35,6 +35,61 @@ void TestTaskConditionalTrue(const DataPoint& data);
 /// @param data the configuration for the microbenchmark
 void TestTaskConditionalFalse(const DataPoint& data);
 
+/// @brief Tasks created by just the master thread, all with priority(task_priority)
+/// @param data the configuration for the microbenchmark
+void TestTaskPriority(const DataPoint& data);
+
+/// @brief Tasks created by just the master thread, alternating between the lowest and the highest priority
+/// @param data the configuration for the microbenchmark
+void TestTaskPriorityMixed(const DataPoint& data);
+
+/// @brief Tied tasks created by the master thread, every task creates a child task doing the work and waits for it
+/// @param data the configuration for the microbenchmark
+void TestTaskChildWaitTied(const DataPoint& data);
+
+/// @brief Untied tasks created by the master thread, every task creates a child task doing the work and waits for it
+/// @param data the configuration for the microbenchmark
+void TestTaskChildWaitUntied(const DataPoint& data);
+
+/// @brief Tied tasks created by the master thread, with a taskyield after the workload
+/// @param data the configuration for the microbenchmark
+void TestTaskYieldTied(const DataPoint& data);
+
+/// @brief Untied tasks created by the master thread, with a taskyield after the workload
+/// @param data the configuration for the microbenchmark
+void TestTaskYieldUntied(const DataPoint& data);
+
+/// @brief Tasks created by the master thread, the workload is protected by a lock, which is polled without yielding
+/// @param data the configuration for the microbenchmark
+void TestTaskLockSpin(const DataPoint& data);
+
+/// @brief Tasks created by the master thread, the workload is protected by a lock, with a taskyield while polling it
+/// @param data the configuration for the microbenchmark
+void TestTaskLockYield(const DataPoint& data);
+
+/// @brief Detached tasks created by the master thread, every task fulfills its own event at the end of its workload
+/// @param data the configuration for the microbenchmark
+void TestTaskDetachImmediate(const DataPoint& data);
+
+/// @brief Detached tasks created by the master thread, the events are fulfilled by an additional completion thread
+/// in batches of batch_size events
+/// @param data the configuration for the microbenchmark
+void TestTaskDetachBatch(const DataPoint& data);
+
+/// @brief Detached tasks created by the master thread, which only publish their event. The additional completion thread
+/// does the workload of every event before it fulfills it, like an asynchronous operation completing after a delay
+/// @param data the configuration for the microbenchmark
+void TestTaskDetachDelayed(const DataPoint& data);
+
+/// @brief Chain of tasks depending on each other with depend(inout), the team has the additional thread of TestTaskDetachChain
+/// @param data the configuration for the microbenchmark
+void TestTaskChain(const DataPoint& data);
+
+/// @brief Chain of detached tasks depending on each other with depend(inout), the events are fulfilled by
+/// an additional completion thread, so every link contains the latency from the fulfillment to the start of the dependent task
+/// @param data the configuration for the microbenchmark
+void TestTaskDetachChain(const DataPoint& data);
+
 /// @brief Reference implementation for task creation overhead
 /// @param data the configuration for the reference
 void Reference(const DataPoint& data);
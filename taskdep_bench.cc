@@ -0,0 +1,306 @@
+#include <omp.h>
+#include <algorithm>
+#include <cmath>
+#include "taskdep_bench.h"
+#include "commons.h"
+
+void RunBenchmarks();
+
+std::string bench_name = "TASKDEP";
+
+// One dependency slot per task, the addresses are used as the list items of the depend clauses.
+// The last slot is never written, it is used as the predecessor of tasks at the border of the wavefront.
+std::vector<char> slots;
+
+// The number of tasks per level and the probability of an edge in percent of the random DAG
+unsigned long long dag_width = 4;
+unsigned long long dag_density = 50;
+
+int main(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    slots.resize(*std::max_element(NUMBER_OF_ITERATIONS.begin(), NUMBER_OF_ITERATIONS.end()) + 1);
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    Benchmark(bench_name, "CHAIN", TestTaskDepChain, Reference);
+    Benchmark(bench_name, "CHAIN_DEPOBJ", TestTaskDepChainDepobj, Reference);
+    Benchmark(bench_name, "FAN_OUT_FAN_IN", TestTaskDepFanOutFanIn, Reference);
+    Benchmark(bench_name, "MUTEXINOUTSET", TestTaskDepMutexinoutset, Reference);
+#ifdef HAVE_OMP_INOUTSET
+    Benchmark(bench_name, "INOUTSET", TestTaskDepInoutset, Reference);
+#else
+    printf("Skipping INOUTSET, depend(inoutset) is not supported by the compiler\n");
+#endif
+    Benchmark(bench_name, "WAVEFRONT", TestTaskDepWavefront, Reference);
+
+    for (unsigned long long width : {4, 16, 64}) {
+        for (unsigned long long density : {10, 50, 90}) {
+            dag_width = width;
+            dag_density = density;
+            Benchmark(bench_name, "RANDOM_DAG_WIDTH_" + std::to_string(width) + "_DENSITY_" + std::to_string(density),
+                      TestTaskDepRandomDag, ReferenceRandomDag);
+        }
+    }
+}
+
+/// @brief Pseudo random, but deterministic edge of the random DAG, so that the test and the reference have the same graph
+bool HasEdge(unsigned long long task, unsigned long long predecessor) {
+    unsigned long long hash = (task * 2654435761ULL) ^ (predecessor * 40503ULL);
+    hash ^= hash >> 13;
+    return hash % 100 < dag_density;
+}
+
+void TestTaskDepChain(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char chain = 0;
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, chain) default(none)
+        {
+            #pragma omp master
+            {
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    #pragma omp task depend(inout : chain) firstprivate(task) shared(workload) default(none)
+                    {
+                        DELAY(workload, task);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskDepChainDepobj(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char chain = 0;
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, chain) default(none)
+        {
+            #pragma omp master
+            {
+                omp_depend_t dependency;
+                #pragma omp depobj(dependency) depend(inout : chain)
+
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    #pragma omp task depend(depobj : dependency) firstprivate(task) shared(workload) default(none)
+                    {
+                        DELAY(workload, task);
+                    }
+                }
+
+                #pragma omp taskwait
+                #pragma omp depobj(dependency) destroy
+            }
+        }
+    }
+}
+
+void TestTaskDepFanOutFanIn(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    char *slot = slots.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char root = 0;
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, root, slot) default(none)
+        {
+            #pragma omp master
+            {
+                // the root and the sink task have no workload, so that the work is the same as in the reference
+                #pragma omp task depend(out : root) default(none)
+                {}
+
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    #pragma omp task depend(in : root) depend(out : slot[task]) firstprivate(task) shared(workload) default(none)
+                    {
+                        DELAY(workload, task);
+                    }
+                }
+
+                #pragma omp task depend(iterator(k = 0 : iterations), in : slot[k]) default(none)
+                {}
+            }
+        }
+    }
+}
+
+void TestTaskDepMutexinoutset(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char root = 0;
+        float accumulator = 0;
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, root, accumulator) default(none)
+        {
+            #pragma omp master
+            {
+                #pragma omp task depend(out : root) default(none)
+                {}
+
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    #pragma omp task depend(in : root) depend(mutexinoutset : accumulator) firstprivate(task) shared(workload, accumulator) default(none)
+                    {
+                        DELAY(workload, task);
+                        accumulator += DELAY_A;
+                    }
+                }
+
+                #pragma omp task depend(in : accumulator) default(none)
+                {}
+            }
+        }
+    }
+}
+
+#ifdef HAVE_OMP_INOUTSET
+void TestTaskDepInoutset(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        char root = 0;
+        char set = 0;
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, root, set) default(none)
+        {
+            #pragma omp master
+            {
+                #pragma omp task depend(out : root) default(none)
+                {}
+
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    #pragma omp task depend(in : root) depend(inoutset : set) firstprivate(task) shared(workload) default(none)
+                    {
+                        DELAY(workload, task);
+                    }
+                }
+
+                #pragma omp task depend(in : set) default(none)
+                {}
+            }
+        }
+    }
+}
+#endif
+
+void TestTaskDepWavefront(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    char *slot = slots.data();
+
+    // the tasks are laid out row by row, the last row might not be full
+    unsigned long long width = ceil(sqrt((double) iterations));
+    unsigned long long border = iterations;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, slot, width, border) default(none)
+        {
+            #pragma omp master
+            {
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    unsigned long long up = task >= width ? task - width : border;
+                    unsigned long long left = task % width != 0 ? task - 1 : border;
+
+                    #pragma omp task depend(in : slot[up], slot[left]) depend(out : slot[task]) firstprivate(task) shared(workload) default(none)
+                    {
+                        DELAY(workload, task);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void TestTaskDepRandomDag(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+    char *slot = slots.data();
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) shared(iterations, workload, slot, dag_width) default(none)
+        {
+            #pragma omp master
+            {
+                std::vector<unsigned long long> predecessors(dag_width);
+                unsigned long long *predecessor = predecessors.data();
+
+                for (unsigned long long task = 0; task < iterations; task++) {
+                    int num_predecessors = 0;
+                    if (task >= dag_width) {
+                        unsigned long long level_begin = (task / dag_width - 1) * dag_width;
+                        for (unsigned long long candidate = level_begin; candidate < level_begin + dag_width; candidate++) {
+                            if (HasEdge(task, candidate)) {
+                                predecessor[num_predecessors++] = candidate;
+                            }
+                        }
+                    }
+
+                    #pragma omp task depend(iterator(k = 0 : num_predecessors), in : slot[predecessor[k]]) depend(out : slot[task]) firstprivate(task) shared(workload) default(none)
+                    {
+                        DELAY(workload, task);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    // the creation order of the tasks is a topological order of all graphs
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (unsigned long long task = 0; task < iterations; task++) {
+            DELAY(workload, task);
+        }
+    }
+}
+
+void ReferenceRandomDag(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        std::vector<unsigned long long> predecessors(dag_width);
+        unsigned long long *predecessor = predecessors.data();
+
+        for (unsigned long long task = 0; task < iterations; task++) {
+            int num_predecessors = 0;
+            if (task >= dag_width) {
+                unsigned long long level_begin = (task / dag_width - 1) * dag_width;
+                for (unsigned long long candidate = level_begin; candidate < level_begin + dag_width; candidate++) {
+                    if (HasEdge(task, candidate)) {
+                        predecessor[num_predecessors++] = candidate;
+                    }
+                }
+            }
+
+            DELAY(workload, task);
+        }
+    }
+}
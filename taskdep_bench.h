@@ -0,0 +1,47 @@
+#ifndef PPT_P4_TASKDEP_H
+#define PPT_P4_TASKDEP_H
+
+#include "commons.h"
+
+/// @brief Linear chain of tasks created by the master thread, every task depends on its predecessor with depend(inout)
+/// @param data the configuration for the microbenchmark
+void TestTaskDepChain(const DataPoint& data);
+
+/// @brief Linear chain of tasks like TestTaskDepChain, but the dependency is given by a depobj object
+/// @param data the configuration for the microbenchmark
+void TestTaskDepChainDepobj(const DataPoint& data);
+
+/// @brief One root task, all other tasks depend on it with depend(in) and one sink task depends on all of them
+/// using an iterator in its depend clause
+/// @param data the configuration for the microbenchmark
+void TestTaskDepFanOutFanIn(const DataPoint& data);
+
+/// @brief Fan out of one root task, the tasks are mutually exclusive with depend(mutexinoutset), but in any order
+/// @param data the configuration for the microbenchmark
+void TestTaskDepMutexinoutset(const DataPoint& data);
+
+#ifdef HAVE_OMP_INOUTSET
+/// @brief Fan out of one root task, the tasks can run concurrently with depend(inoutset), the sink task waits for all of them
+/// @param data the configuration for the microbenchmark
+void TestTaskDepInoutset(const DataPoint& data);
+#endif
+
+/// @brief The tasks form a 2D grid, every task depends on its upper and its left neighbour (wavefront stencil)
+/// @param data the configuration for the microbenchmark
+void TestTaskDepWavefront(const DataPoint& data);
+
+/// @brief Random DAG with dag_width tasks per level, every task depends on a task of the previous level
+/// with a probability of dag_density percent, the depend clause uses an iterator over the predecessors
+/// @param data the configuration for the microbenchmark
+void TestTaskDepRandomDag(const DataPoint& data);
+
+/// @brief Reference implementation, the tasks executed serially in a topological order
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+/// @brief Reference implementation for the random DAG, the edges are calculated like in the test,
+/// the tasks are executed serially in a topological order
+/// @param data the configuration for the reference
+void ReferenceRandomDag(const DataPoint& data);
+
+#endif //PPT_P4_TASKDEP_H
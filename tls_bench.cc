@@ -0,0 +1,225 @@
+#include <omp.h>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include "tls_bench.h"
+#include "commons.h"
+
+// This file is built with -O2, the accesses are in functions that are not inlined,
+// so that the address of the thread local variable is computed for every access, like in library code
+#if defined(__GNUC__) || defined(__clang__)
+    #define NO_INLINE __attribute__((noinline))
+#else
+    #define NO_INLINE
+#endif
+
+#define CACHE_LINE_SIZE 64
+
+// Runs all microbenchmarks
+void RunBenchmarks();
+
+/// @brief Prints for every mechanism how many threads still see their value in a following parallel region,
+/// with the same number of threads and after a parallel region with one thread
+void PrintTlsPersistence();
+
+#ifdef TLS_SHARED_LIBRARY
+std::string bench_name = "TLS_PIC";
+#else
+std::string bench_name = "TLS";
+#endif
+
+// The variables are not static, so that they use the general dynamic TLS model in the shared library.
+// GCC implements threadprivate with the same thread local storage as thread_local
+float threadprivate_value = 0;
+#pragma omp threadprivate(threadprivate_value)
+
+thread_local float thread_local_static_value = 0;
+
+NO_INLINE float InitialValue() {
+    return 0;
+}
+
+thread_local float thread_local_dynamic_value = InitialValue();
+
+/// @brief A value on its own cache line
+struct PaddedValue {
+    float value = 0;
+    char padding[CACHE_LINE_SIZE];
+};
+
+// one element per thread, allocated for the maximum number of threads
+std::vector<PaddedValue> thread_values;
+
+float global_value = 0;
+
+NO_INLINE void AddThreadprivate(float value) {
+    threadprivate_value += value;
+}
+
+NO_INLINE void AddThreadLocalStatic(float value) {
+    thread_local_static_value += value;
+}
+
+NO_INLINE void AddThreadLocalDynamic(float value) {
+    thread_local_dynamic_value += value;
+}
+
+NO_INLINE void AddPrivate(float &private_value, float value) {
+    private_value += value;
+}
+
+NO_INLINE void AddThreadNumArray(float value) {
+    thread_values[omp_get_thread_num()].value += value;
+}
+
+NO_INLINE void AddGlobal(float value) {
+    global_value += value;
+}
+
+#ifndef TLS_SHARED_LIBRARY
+int main(int argc, char **argv) {
+    return TlsBenchMain(argc, argv);
+}
+#endif
+
+int TlsBenchMain(int argc, char **argv) {
+
+    ParseArgs(argc, argv);
+
+    PrintCompilerVersion();
+
+    if (SAVE_FOR_EXTRAP) {
+        RemoveBench(bench_name);
+    }
+
+    thread_values.resize(*std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end()));
+
+    RunBenchmarks();
+
+    return 0;
+}
+
+void RunBenchmarks() {
+    Benchmark(bench_name, "THREADPRIVATE", TestThreadprivate, Reference);
+    Benchmark(bench_name, "THREAD_LOCAL_STATIC", TestThreadLocalStatic, Reference);
+    Benchmark(bench_name, "THREAD_LOCAL_DYNAMIC", TestThreadLocalDynamic, Reference);
+    Benchmark(bench_name, "PRIVATE", TestPrivate, Reference);
+    Benchmark(bench_name, "THREAD_NUM_ARRAY", TestThreadNumArray, Reference);
+    PrintTlsPersistence();
+}
+
+// The result of the workload is added to the variable, otherwise the workload is removed at -O2
+#define DEFINE_TLS_TEST(NAME, ADD) \
+void NAME(const DataPoint& data) { \
+    unsigned int threads = data.threads; \
+    unsigned long long int iterations = data.iterations; \
+    unsigned long workload = data.workload; \
+\
+    for (int rep = 0; rep < data.directive; rep++) { \
+        PRAGMA(omp parallel for num_threads(threads) default(none) shared(iterations, workload)) \
+        for (int i = 0; i < iterations; i++) { \
+            DELAY(workload, i); \
+            ADD(DELAY_A); \
+        } \
+    } \
+}
+
+DEFINE_TLS_TEST(TestThreadprivate, AddThreadprivate)
+DEFINE_TLS_TEST(TestThreadLocalStatic, AddThreadLocalStatic)
+DEFINE_TLS_TEST(TestThreadLocalDynamic, AddThreadLocalDynamic)
+DEFINE_TLS_TEST(TestThreadNumArray, AddThreadNumArray)
+#undef DEFINE_TLS_TEST
+
+void TestPrivate(const DataPoint& data) {
+    unsigned int threads = data.threads;
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        #pragma omp parallel num_threads(threads) default(none) shared(iterations, workload)
+        {
+            float private_value = 0;
+            #pragma omp for
+            for (int i = 0; i < iterations; i++) {
+                DELAY(workload, i);
+                AddPrivate(private_value, DELAY_A);
+            }
+        }
+    }
+}
+
+void Reference(const DataPoint& data) {
+    unsigned int threads = data.threads; // not used, only here for equal amount of work in Test and Reference
+    unsigned long long int iterations = data.iterations;
+    unsigned long workload = data.workload;
+
+    for (int rep = 0; rep < data.directive; rep++) {
+        for (int i = 0; i < iterations; i++) {
+            DELAY(workload, i);
+            AddGlobal(DELAY_A);
+        }
+    }
+}
+
+void PrintTlsPersistence() {
+    if (QUIET) {
+        return;
+    }
+
+    unsigned int threads = *std::max_element(NUMBER_OF_THREADS.begin(), NUMBER_OF_THREADS.end());
+    // the number of threads which still see their value, per mechanism, with the same team and after one thread
+    int same_team[4] = {0, 0, 0, 0};
+    int after_one_thread[4] = {0, 0, 0, 0};
+
+    for (int *persisted : {same_team, after_one_thread}) {
+        bool one_thread_region = persisted == after_one_thread;
+
+        #pragma omp parallel num_threads(threads) default(none) shared(thread_values)
+        {
+            float value = (float) omp_get_thread_num() + 1;
+            threadprivate_value = value;
+            thread_local_static_value = value;
+            thread_local_dynamic_value = value;
+            thread_values[omp_get_thread_num()].value = value;
+        }
+
+        if (one_thread_region) {
+            #pragma omp parallel num_threads(1) default(none) shared(thread_values)
+            {
+                threadprivate_value = 0;
+                thread_local_static_value = 0;
+                thread_local_dynamic_value = 0;
+                thread_values[omp_get_thread_num()].value = 0;
+            }
+        }
+
+        #pragma omp parallel num_threads(threads) default(none) shared(persisted, one_thread_region, thread_values)
+        {
+            float value = (float) omp_get_thread_num() + 1;
+            // the master thread is reset by the region with one thread
+            if (one_thread_region && omp_get_thread_num() == 0) {
+                value = 0;
+            }
+            #pragma omp atomic
+            persisted[0] += threadprivate_value == value;
+            #pragma omp atomic
+            persisted[1] += thread_local_static_value == value;
+            #pragma omp atomic
+            persisted[2] += thread_local_dynamic_value == value;
+            #pragma omp atomic
+            persisted[3] += thread_values[omp_get_thread_num()].value == value;
+        }
+    }
+
+    const std::string names[4] = {"THREADPRIVATE", "THREAD_LOCAL_STATIC", "THREAD_LOCAL_DYNAMIC", "THREAD_NUM_ARRAY"};
+
+    std::cout << "Name of test: TLS_PERSISTENCE" << std::endl;
+    std::cout << "Threads: " << threads << ", dynamic adjustment: " << (omp_get_dynamic() ? "true" : "false")
+              << ", threads keeping their value in the next parallel region" << std::endl;
+    std::cout << "Mechanism            | Same team | After one thread" << std::endl;
+    for (int mechanism = 0; mechanism < 4; mechanism++) {
+        std::cout << std::left << std::setw(20) << names[mechanism] << std::right
+                  << " | " << std::setw(9) << same_team[mechanism]
+                  << " | " << std::setw(16) << after_one_thread[mechanism] << std::endl;
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef PPT_P4_TLS_H
+#define PPT_P4_TLS_H
+
+#include "commons.h"
+
+/// @brief Parses the arguments and runs all microbenchmarks, main of tls_bench and tls_bench_pic
+int TlsBenchMain(int argc, char **argv);
+
+/// @brief DoAll loop, every iteration adds its result to a threadprivate global in a function that is not inlined
+/// @param data the configuration for the microbenchmark
+void TestThreadprivate(const DataPoint& data);
+
+/// @brief DoAll loop, every iteration adds its result to a thread_local global with static (constant) initialization
+/// @param data the configuration for the microbenchmark
+void TestThreadLocalStatic(const DataPoint& data);
+
+/// @brief DoAll loop, every iteration adds its result to a thread_local global with dynamic initialization,
+/// every access goes through the wrapper checking whether the variable of the thread is initialized
+/// @param data the configuration for the microbenchmark
+void TestThreadLocalDynamic(const DataPoint& data);
+
+/// @brief DoAll loop, every iteration adds its result to a variable declared in the parallel region, passed by reference
+/// @param data the configuration for the microbenchmark
+void TestPrivate(const DataPoint& data);
+
+/// @brief DoAll loop, every iteration adds its result to the element omp_get_thread_num() of a global array with padded elements
+/// @param data the configuration for the microbenchmark
+void TestThreadNumArray(const DataPoint& data);
+
+/// @brief Reference implementation, adds the result of every iteration to a global in one thread
+/// @param data the configuration for the reference
+void Reference(const DataPoint& data);
+
+#endif //PPT_P4_TLS_H
@@ -0,0 +1,6 @@
+#include "tls_bench.h"
+
+// tls_bench built into a shared library, the thread local variables of shared libraries use the general dynamic TLS model
+int main(int argc, char **argv) {
+    return TlsBenchMain(argc, argv);
+}